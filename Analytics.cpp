@@ -0,0 +1,227 @@
+/*
+ * Analytics.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <random>
+#include <thread>
+
+#include "Analytics.h"
+#include "Mandelbrot.h"
+
+void Statistics::add(const Statistics &statistics) {
+	samples += statistics.samples;
+	inside += statistics.inside;
+	transitions += statistics.transitions;
+	stratumVariance += statistics.stratumVariance;
+
+	if (histogram.size() < statistics.histogram.size()) {
+		histogram.resize(statistics.histogram.size(), 0);
+	}
+
+	for (size_t i = 0; i < statistics.histogram.size(); i++) {
+		histogram[i] += statistics.histogram[i];
+	}
+}
+
+Analytics::Analytics(unsigned width, unsigned height, int numOfThreads, int iterations) {
+	this->width = width;
+	this->height = height;
+	this->numOfThreads = numOfThreads;
+	this->iterations = iterations;
+}
+
+void Analytics::setViewport(double centerRe, double centerIm, double scale) {
+	this->centerRe = centerRe;
+	this->centerIm = centerIm;
+	this->scale = scale;
+	hasViewport = true;
+}
+
+Statistics Analytics::scanGrid() {
+	Mandelbrot mandelbrot(width, height, 0, width, 0, height, iterations);
+
+	if (hasViewport) {
+		mandelbrot.setViewport(centerRe, centerIm, scale);
+	}
+
+	std::vector<Statistics> partStatistics(numOfThreads);
+	std::vector<std::thread> workers;
+
+	for (int i = 0; i < numOfThreads; i++) {
+		// every thread scans a band of rows, the row above the band is calculated again for the vertical transitions
+		workers.push_back(std::thread([&, i]() {
+			unsigned minY = (unsigned) ((uint64_t) i * height / numOfThreads);
+			unsigned maxY = (unsigned) ((uint64_t) (i + 1) * height / numOfThreads);
+
+			// local counters -> no false sharing between the neighboured elements of partStatistics, and the
+			// compiler can keep them in registers (the histogram writes could alias the members of the struct)
+			std::vector<uint64_t> histogram(iterations + 1, 0);
+			uint64_t inside = 0, transitions = 0;
+
+			std::vector<unsigned char> previousRow(width, 0), row(width, 0);
+
+			if (minY > 0) {
+				for (unsigned x = 0; x < width; ++x) {
+					previousRow[x] = mandelbrot.isInside(x, minY - 1) ? 1 : 0;
+				}
+			}
+
+			for (unsigned y = minY; y < maxY; ++y) {
+				double c_im = mandelbrot.getIm(y);
+
+				for (unsigned x = 0; x < width; ++x) {
+					unsigned n = mandelbrot.escapeTime(mandelbrot.getRe(x), c_im);
+
+					row[x] = (n == (unsigned) iterations) ? 1 : 0;
+
+					histogram[n]++;
+					inside += row[x];
+
+					if (x > 0 && row[x] != row[x - 1]) {
+						transitions++;
+					}
+
+					if (y > 0 && row[x] != previousRow[x]) {
+						transitions++;
+					}
+				}
+
+				row.swap(previousRow);
+			}
+
+			Statistics &statistics = partStatistics[i];
+			statistics.histogram.swap(histogram);
+			statistics.inside = inside;
+			statistics.transitions = transitions;
+			statistics.samples = (uint64_t) width * (maxY - minY);
+		}));
+	}
+
+	for (auto &th : workers) {
+		th.join();
+	}
+
+	// reduce the statistics of the threads
+	Statistics result;
+
+	for (auto &statistics : partStatistics) {
+		result.add(statistics);
+	}
+
+	double stepRe = mandelbrot.getRe(1) - mandelbrot.getRe(0);
+	double stepIm = mandelbrot.getIm(0) - mandelbrot.getIm(1);
+	double cellArea = stepRe * stepIm;
+
+	result.area = result.inside * cellArea;
+
+	// the result of a cell at the boundary is only correct for its center -> half a cell per transition
+	result.areaError = result.transitions * cellArea / 2;
+	result.boundaryLength = M_PI / 4 * result.transitions * sqrt(cellArea);
+
+	return result;
+}
+
+Statistics Analytics::sampleStratified(unsigned samplesPerStratum, unsigned long seed) {
+	Mandelbrot mandelbrot(width, height, 0, width, 0, height, iterations);
+
+	if (hasViewport) {
+		mandelbrot.setViewport(centerRe, centerIm, scale);
+	}
+
+	double stepRe = mandelbrot.getRe(1) - mandelbrot.getRe(0);
+	double stepIm = mandelbrot.getIm(0) - mandelbrot.getIm(1);
+
+	std::vector<Statistics> partStatistics(numOfThreads);
+	std::vector<std::thread> workers;
+
+	for (int i = 0; i < numOfThreads; i++) {
+		workers.push_back(std::thread([&, i]() {
+			// own random generator for every thread
+			std::seed_seq seq { (uint64_t) seed, (uint64_t) i };
+			std::mt19937_64 generator(seq);
+			std::uniform_real_distribution<double> offset(-0.5, 0.5);
+
+			// local counters, written to partStatistics once at the end (see scanGrid())
+			std::vector<uint64_t> histogram(iterations + 1, 0);
+			uint64_t inside = 0, stratumVariance = 0, samples = 0;
+
+			// rows are interleaved between the threads -> similar work for every thread
+			for (unsigned y = i; y < height; y += numOfThreads) {
+				double c_im = mandelbrot.getIm(y);
+
+				for (unsigned x = 0; x < width; ++x) {
+					double c_re = mandelbrot.getRe(x);
+					uint64_t n = 0;
+
+					for (unsigned k = 0; k < samplesPerStratum; ++k) {
+						unsigned escape = mandelbrot.escapeTime(c_re + offset(generator) * stepRe, c_im + offset(generator) * stepIm);
+
+						histogram[escape]++;
+
+						if (escape == (unsigned) iterations) {
+							n++;
+						}
+					}
+
+					inside += n;
+					stratumVariance += n * (samplesPerStratum - n);
+				}
+
+				samples += (uint64_t) width * samplesPerStratum;
+			}
+
+			Statistics &statistics = partStatistics[i];
+			statistics.histogram.swap(histogram);
+			statistics.inside = inside;
+			statistics.stratumVariance = stratumVariance;
+			statistics.samples = samples;
+		}));
+	}
+
+	for (auto &th : workers) {
+		th.join();
+	}
+
+	Statistics result;
+
+	for (auto &statistics : partStatistics) {
+		result.add(statistics);
+	}
+
+	double cellArea = stepRe * stepIm;
+	double k = samplesPerStratum;
+
+	result.area = result.inside * cellArea / k;
+
+	// variance of the mean of every stratum: p * (1 - p) / (k - 1) with p = n / k
+	if (samplesPerStratum > 1) {
+		result.areaError = sqrt(result.stratumVariance * cellArea * cellArea / (k * k * (k - 1)));
+	} else {
+		result.areaError = NAN;
+	}
+
+	return result;
+}
+
+void Analytics::print(const Statistics &statistics) {
+	std::cout << "samples: " << statistics.samples << ", inside: " << statistics.inside << std::endl;
+	std::cout << "area: " << statistics.area << " +- " << statistics.areaError << std::endl;
+
+	if (statistics.transitions > 0) {
+		std::cout << "boundary length (at this resolution): " << statistics.boundaryLength << std::endl;
+	}
+
+	std::cout << "escape time histogram:" << std::endl;
+
+	for (size_t n = 0; n < statistics.histogram.size(); n++) {
+		if (statistics.histogram[n] != 0) {
+			std::cout << "  " << ((n + 1 == statistics.histogram.size()) ? "inside" : std::to_string(n)) << "\t"
+					  << statistics.histogram[n] << std::endl;
+		}
+	}
+
+	std::cout << std::endl;
+}
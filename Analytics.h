@@ -0,0 +1,95 @@
+/*
+ * Analytics.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ *  src:
+ *
+ *  [1]	https://en.wikipedia.org/wiki/Mandelbrot_set#Basic_properties (area ~ 1.5066)
+ *  [2] https://en.wikipedia.org/wiki/Stratified_sampling
+ *  [3] https://en.wikipedia.org/wiki/Crofton_formula
+ */
+
+#ifndef ANALYTICS_H_
+#define ANALYTICS_H_
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+struct Statistics
+{
+	uint64_t samples = 0;
+	uint64_t inside = 0;
+
+	// escape time histogram, histogram[iterations] counts the samples inside of the set
+	std::vector<uint64_t> histogram;
+
+	// grid: number of neighboured pixels (horizontal and vertical) with different results
+	uint64_t transitions = 0;
+
+	// stratified sampling: sum of n * (k - n) over all strata (n of k samples inside)
+	uint64_t stratumVariance = 0;
+
+	// results (complex plane units)
+	double area = 0;
+	double areaError = 0;
+	double boundaryLength = 0;
+
+	void add(const Statistics &statistics);
+};
+
+class Analytics {
+  public:
+	/** constructor; the analyzed region is a grid of width x height pixels on the default viewport (see Mandelbrot),
+	 * 	no image is stored -> every thread only keeps its own counters (and one row of the grid for the boundary).
+	 *
+	 *  @param	specify the width and height of the grid
+	 *  @param	specify the number of threads and iterations
+	 *  @return ---
+	*/
+	Analytics(unsigned width, unsigned height, int numOfThreads, int iterations);
+
+	/** function to move the analyzed region, see Mandelbrot::setViewport()
+	 *
+	 *  @param	specify the center of the region (real and imaginary part)
+	 *  @param	specify the pixel scale (size of one grid cell in the complex plane)
+	 *  @return ---
+	*/
+	void setViewport(double centerRe, double centerIm, double scale);
+
+	/** function to run the kernel on every point of the grid; the area is estimated by the number of inside points, the
+	 * 	error by the cells at the boundary and the boundary length by counting the transitions between neighbours
+	 * 	(Crofton formula, L = pi/4 * transitions * scale).
+	 *
+	 *  @param	---
+	 *  @return the statistics of the grid
+	*/
+	Statistics scanGrid();
+
+	/** function to estimate the statistics by stratified random sampling; every cell of the grid is a stratum with
+	 * 	samplesPerStratum random points. The memory is constant, independent of the number of samples
+	 * 	(width * height * samplesPerStratum, e.g. 10^5 x 10^5 x 10 = 10^11 samples).
+	 *
+	 *  @param	specify the number of samples per stratum (at least 2 to estimate the error)
+	 *  @param	specify the seed of the random generators
+	 *  @return the statistics of the samples
+	*/
+	Statistics sampleStratified(unsigned samplesPerStratum, unsigned long seed);
+
+	/** function to print the statistics
+	 *
+	 *  @param	pass the statistics
+	 *  @return ---
+	*/
+	void print(const Statistics &statistics);
+
+  private:
+	unsigned width, height;
+	int numOfThreads, iterations;
+
+	bool hasViewport = false;
+	double centerRe = 0, centerIm = 0, scale = 0;
+};
+
+#endif /* ANALYTICS_H_ */
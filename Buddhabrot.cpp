@@ -0,0 +1,262 @@
+/*
+ * Buddhabrot.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <thread>
+
+#include "Buddhabrot.h"
+
+// c lies in the main cardioid or the period-2 bulb -> its orbit never escapes
+static bool isInMainBulbs(double c_re, double c_im) {
+	double q = (c_re - 0.25) * (c_re - 0.25) + c_im * c_im;
+
+	if (q * (q + (c_re - 0.25)) <= 0.25 * c_im * c_im) {
+		return true;
+	}
+
+	return (c_re + 1) * (c_re + 1) + c_im * c_im <= 0.0625;
+}
+
+Buddhabrot::Buddhabrot(unsigned width, unsigned height, int numOfThreads) {
+	this->width = width;
+	this->height = height;
+	this->numOfThreads = numOfThreads;
+
+	setViewport(-0.5, 0, 3.0 / width);
+}
+
+void Buddhabrot::setViewport(double centerRe, double centerIm, double scale) {
+	// same convention as Mandelbrot::setViewport(), the center lies on pixel (width/2|height/2)
+	this->minRe = centerRe - scale * (width / 2);
+	this->maxIm = centerIm + scale * (height / 2);
+	this->scale = scale;
+}
+
+std::vector<double> Buddhabrot::createImportanceMap(int iterations) {
+	std::vector<double> weights(mapSize * mapSize, 0);
+	std::vector<std::thread> workers;
+
+	double cellSize = 4.0 / mapSize;
+
+	// the map only guides the sampling, its test points don't need the full depth
+	int maxIterations = std::min(iterations, 1000);
+
+	for (int i = 0; i < numOfThreads; i++) {
+		workers.push_back(std::thread([&, i]() {
+			for (unsigned cy = i; cy < mapSize; cy += numOfThreads) {
+				for (unsigned cx = 0; cx < mapSize; ++cx) {
+					double orbitLength = 0;
+					int escaped = 0;
+
+					// 3x3 test points in every cell
+					for (int ty = 0; ty < 3; ++ty) {
+						for (int tx = 0; tx < 3; ++tx) {
+							double c_re = -2.0 + (cx + (tx + 0.5) / 3) * cellSize;
+							double c_im = -2.0 + (cy + (ty + 0.5) / 3) * cellSize;
+
+							if (isInMainBulbs(c_re, c_im)) {
+								continue;
+							}
+
+							double Z_re = c_re, Z_im = c_im;
+
+							for (int n = 0; n < maxIterations; ++n) {
+								double Z_re2 = Z_re * Z_re, Z_im2 = Z_im * Z_im;
+
+								if (Z_re2 + Z_im2 > 4) {
+									orbitLength += n;
+									escaped++;
+									break;
+								}
+
+								Z_im = 2 * Z_re * Z_im + c_im;
+								Z_re = Z_re2 - Z_im2 + c_re;
+							}
+						}
+					}
+
+					weights[cy * mapSize + cx] = (escaped > 0) ? orbitLength / escaped : 0;
+				}
+			}
+		}));
+	}
+
+	for (auto &th : workers) {
+		th.join();
+	}
+
+	double totalWeight = 0;
+	for (double w : weights) {
+		totalWeight += w;
+	}
+
+	// half of the samples are drawn uniformly -> every cell can be sampled (unbiased) and the weight of a sample
+	// (uniform probability / importance probability) is at most 2, so no single orbit dominates the image
+	for (double &w : weights) {
+		w = 0.5 * (totalWeight > 0 ? w / totalWeight : 1.0 / weights.size()) + 0.5 / weights.size();
+	}
+
+	return weights;
+}
+
+std::vector<float> Buddhabrot::calculateDensity(int iterations, uint64_t numOfSamples, unsigned long seed) {
+	std::vector<double> probabilities = createImportanceMap(iterations);
+
+	double cellSize = 4.0 / mapSize;
+
+	// one private histogram per thread
+	std::vector< std::vector<float> > histograms(numOfThreads);
+	std::vector<std::thread> workers;
+
+	for (int i = 0; i < numOfThreads; i++) {
+		workers.push_back(std::thread([&, i]() {
+			std::seed_seq seq { (uint64_t) seed, (uint64_t) i };
+			std::mt19937_64 generator(seq);
+			std::discrete_distribution<size_t> cells(probabilities.begin(), probabilities.end());
+			std::uniform_real_distribution<double> offset(0.0, 1.0);
+
+			std::vector<float> &histogram = histograms[i];
+			histogram.assign((size_t) width * height, 0);
+
+			std::vector<double> orbitRe(iterations), orbitIm(iterations);
+
+			uint64_t begin = numOfSamples * i / numOfThreads;
+			uint64_t end = numOfSamples * (i + 1) / numOfThreads;
+
+			for (uint64_t s = begin; s < end; ++s) {
+				size_t cell = cells(generator);
+
+				double c_re = -2.0 + ((cell % mapSize) + offset(generator)) * cellSize;
+				double c_im = -2.0 + ((cell / mapSize) + offset(generator)) * cellSize;
+
+				if (isInMainBulbs(c_re, c_im)) {
+					continue;
+				}
+
+				double Z_re = c_re, Z_im = c_im;
+				int n = 0;
+
+				for (; n < iterations; ++n) {
+					double Z_re2 = Z_re * Z_re, Z_im2 = Z_im * Z_im;
+
+					if (Z_re2 + Z_im2 > 4) {
+						break;
+					}
+
+					orbitRe[n] = Z_re;
+					orbitIm[n] = Z_im;
+
+					Z_im = 2 * Z_re * Z_im + c_im;
+					Z_re = Z_re2 - Z_im2 + c_re;
+				}
+
+				if (n == iterations) {
+					// orbit doesn't escape -> not part of the Buddhabrot
+					continue;
+				}
+
+				// uniform probability of the cell / probability of the importance map
+				float weight = (float) (1.0 / (probabilities[cell] * probabilities.size()));
+
+				for (int k = 0; k < n; ++k) {
+					long x = lround((orbitRe[k] - minRe) / scale);
+					long y = lround((maxIm - orbitIm[k]) / scale);
+
+					if (x >= 0 && y >= 0 && x < (long) width && y < (long) height) {
+						histogram[y * width + x] += weight;
+					}
+				}
+			}
+		}));
+	}
+
+	for (auto &th : workers) {
+		th.join();
+	}
+
+	// parallel reduction: every thread sums up a stripe of rows of all histograms
+	std::vector<float> density((size_t) width * height, 0);
+	workers.clear();
+
+	for (int i = 0; i < numOfThreads; i++) {
+		workers.push_back(std::thread([&, i]() {
+			size_t begin = (size_t) height * i / numOfThreads * width;
+			size_t end = (size_t) height * (i + 1) / numOfThreads * width;
+
+			for (auto &histogram : histograms) {
+				for (size_t p = begin; p < end; ++p) {
+					density[p] += histogram[p];
+				}
+			}
+		}));
+	}
+
+	for (auto &th : workers) {
+		th.join();
+	}
+
+	return density;
+}
+
+void Buddhabrot::toneMap(const std::vector<float> &density, std::vector<unsigned int> &values) {
+	float maxDensity = 0;
+	for (float d : density) {
+		maxDensity = std::max(maxDensity, d);
+	}
+
+	values.assign(density.size(), 0);
+
+	if (maxDensity <= 0) {
+		return;
+	}
+
+	for (size_t p = 0; p < density.size(); ++p) {
+		values[p] = (unsigned int) lround(255 * sqrt(density[p] / maxDensity));
+	}
+}
+
+void Buddhabrot::render(PPMImage &image, int iterations, uint64_t numOfSamples, unsigned long seed) {
+	std::cout << "Calculating Buddhabrot with " << numOfSamples << " samples, " << iterations << " iterations ..." << std::endl;
+
+	std::vector<unsigned int> values;
+	toneMap(calculateDensity(iterations, numOfSamples, seed), values);
+
+	for (unsigned y = 0; y < height; ++y) {
+		for (unsigned x = 0; x < width; ++x) {
+			image[y][x].r = values[y * width + x];
+			image[y][x].g = values[y * width + x];
+			image[y][x].b = values[y * width + x];
+		}
+	}
+
+	image.setMaxValue(255);
+
+	std::cout << "done.\n" << std::endl;
+}
+
+void Buddhabrot::renderNebulabrot(PPMImage &image, int iterationsR, int iterationsG, int iterationsB, uint64_t numOfSamples, unsigned long seed) {
+	std::cout << "Calculating Nebulabrot with " << numOfSamples << " samples, " << iterationsR << "/" << iterationsG << "/"
+			  << iterationsB << " iterations ..." << std::endl;
+
+	std::vector<unsigned int> r, g, b;
+	toneMap(calculateDensity(iterationsR, numOfSamples, seed), r);
+	toneMap(calculateDensity(iterationsG, numOfSamples, seed + 1), g);
+	toneMap(calculateDensity(iterationsB, numOfSamples, seed + 2), b);
+
+	for (unsigned y = 0; y < height; ++y) {
+		for (unsigned x = 0; x < width; ++x) {
+			image[y][x].r = r[y * width + x];
+			image[y][x].g = g[y * width + x];
+			image[y][x].b = b[y * width + x];
+		}
+	}
+
+	image.setMaxValue(255);
+
+	std::cout << "done.\n" << std::endl;
+}
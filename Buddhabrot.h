@@ -0,0 +1,99 @@
+/*
+ * Buddhabrot.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ *  src:
+ *
+ *  [1]	https://en.wikipedia.org/wiki/Buddhabrot
+ *  [2] http://superliminal.com/fractals/bbrot/bbrot.htm
+ *  [3] https://en.wikipedia.org/wiki/Importance_sampling
+ *  [4] https://en.wikipedia.org/wiki/Plotting_algorithms_for_the_Mandelbrot_set#Cardioid_/_bulb_checking
+ *  [5] https://artowen.su.domains/mc/Ch-var-is.pdf (defensive importance sampling)
+ */
+
+#ifndef BUDDHABROT_H_
+#define BUDDHABROT_H_
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "PPMImage.h"
+
+class Buddhabrot {
+  public:
+	/** constructor; the density is accumulated on a grid of width x height pixels, which shows -2.0 ... 1.0 on the real axis
+	 * 	(for a square image) centered on -0.5 + 0i
+	 *
+	 *  @param	specify the width and height of the image
+	 *  @param	specify the number of threads
+	 *  @return ---
+	*/
+	Buddhabrot(unsigned width, unsigned height, int numOfThreads);
+
+	/** function to move the viewport of the image, see Mandelbrot::setViewport()
+	 *
+	 *  @param	specify the center of the viewport (real and imaginary part)
+	 *  @param	specify the pixel scale (size of one pixel in the complex plane)
+	 *  @return ---
+	*/
+	void setViewport(double centerRe, double centerIm, double scale);
+
+	/** function to calculate the orbit density: numOfSamples points c are sampled, the orbit of every c which escapes within
+	 * 	the given iterations is iterated again and every visited point z is counted in the pixel it falls into.
+	 *
+	 * 	The samples are drawn from a coarse importance map of -2 ... 2 x -2 ... 2, which favours the cells near the boundary
+	 * 	(long escaping orbits); every orbit is weighted with (uniform probability / importance probability), so the density
+	 * 	is the same as with uniform sampling but with far less noise. Every thread accumulates into its own histogram,
+	 * 	the histograms are summed up afterwards by all threads (each one a stripe of rows) -> no atomic counters.
+	 *
+	 *  @param	specify the maximum number of iterations (orbits which don't escape are not counted)
+	 *  @param	specify the number of samples and the seed of the random generators
+	 *  @return the density for every pixel in rows
+	*/
+	std::vector<float> calculateDensity(int iterations, uint64_t numOfSamples, unsigned long seed);
+
+	/** function to render a Buddhabrot image (gray) with color values 0 ... 255
+	 *
+	 *  @param	pass the image to store the result (width x height)
+	 *  @param	specify the iterations, number of samples and the seed
+	 *  @return ---
+	*/
+	void render(PPMImage &image, int iterations, uint64_t numOfSamples, unsigned long seed);
+
+	/** function to render a Nebulabrot image; the red, green and blue channel are Buddhabrot densities with different
+	 * 	numbers of iterations (e.g. 5000, 500, 50)
+	 *
+	 *  @param	pass the image to store the result (width x height)
+	 *  @param	specify the iterations of the red, green and blue channel
+	 *  @param	specify the number of samples (per channel) and the seed
+	 *  @return ---
+	*/
+	void renderNebulabrot(PPMImage &image, int iterationsR, int iterationsG, int iterationsB, uint64_t numOfSamples, unsigned long seed);
+
+  private:
+	/** function to create the importance map of the sampling region; every cell is weighted with the average length of the
+	 * 	escaping orbits of a few test points, mixed half and half with a uniform distribution (so that no cell is excluded)
+	 *
+	 *  @param	specify the iterations
+	 *  @return probability of every cell of the map in rows
+	*/
+	std::vector<double> createImportanceMap(int iterations);
+
+	/** function to scale a density to the color values 0 ... 255 (square root for more visible details)
+	 *
+	 *  @param	pass the density
+	 *  @return &values will contain the color value of every pixel
+	*/
+	void toneMap(const std::vector<float> &density, std::vector<unsigned int> &values);
+
+	static const unsigned mapSize = 256;
+
+	unsigned width, height;
+	int numOfThreads;
+
+	double minRe, maxIm, scale;
+};
+
+#endif /* BUDDHABROT_H_ */
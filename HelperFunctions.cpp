@@ -7,12 +7,10 @@
 
 #include "HelperFunctions.h"
 
-HelperFunctions *HelperFunctions::instance = 0;
-
 HelperFunctions* HelperFunctions::getInstance() {
-	if (!instance)
-		instance = new HelperFunctions();
-	return instance;
+	// function local static -> thread safe initialization, the Mandelbrot objects are created inside the threads
+	static HelperFunctions instance;
+	return &instance;
 }
 
 int HelperFunctions::gcd(int a, int b) {
@@ -71,3 +69,19 @@ std::string HelperFunctions::decToBinary(std::string &input, int bit) {
 	return result;
 }
 
+void HelperFunctions::combineBits(const std::vector<unsigned char> &pixels, int numOfCombinedBits, std::string &returnBuf) {
+	// compression buffer
+	int bufIndex = 0;
+	int valCoded = 0;
+
+	for (size_t i = 0; i < pixels.size(); ++i) {
+		valCoded = (valCoded << 1) + (pixels[i] ? 1 : 0);
+		bufIndex++;
+
+		if (bufIndex > numOfCombinedBits - 1) {
+			bufIndex = 0;
+			returnBuf += std::to_string(valCoded) + "\n";
+			valCoded = 0;
+		}
+	}
+}
@@ -19,6 +19,8 @@
 #define HELPERFUNCTIONS_H_
 
 #include <iostream>
+#include <string>
+#include <vector>
 
 class HelperFunctions {
   public:
@@ -32,8 +34,14 @@ class HelperFunctions {
 
 	std::string decToBinary(std::string &input, int bit);
 
-  private:
-	static HelperFunctions* instance;
+	/** function to combine numOfCombinedBits pixels (1 = inside, 0 = outside) to one int value of the compressed *.ppm
+	 * 	format, e.g. 0110 0010 ... -> 6 2 ...; every value is appended to returnBuf in its own line.
+	 *
+	 *  @param	specify the pixels, the number of pixels has to be a multiple of numOfCombinedBits
+	 *  @param	specify the number of combined bits
+	 *  @return &returnBuf will contain the appended values
+	*/
+	void combineBits(const std::vector<unsigned char> &pixels, int numOfCombinedBits, std::string &returnBuf);
 };
 
 #endif /* HELPERFUNCTIONS_H_ */
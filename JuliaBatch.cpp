@@ -0,0 +1,199 @@
+/*
+ * JuliaBatch.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "JuliaBatch.h"
+#include "Mandelbrot.h"
+
+JuliaBatch::JuliaBatch(unsigned thumbnailSize, int numOfThreads, int iterations) {
+	this->thumbnailSize = thumbnailSize;
+	this->numOfThreads = numOfThreads;
+	this->iterations = iterations;
+}
+
+void JuliaBatch::addParameter(double c_re, double c_im) {
+	parametersRe.push_back(c_re);
+	parametersIm.push_back(c_im);
+}
+
+void JuliaBatch::addParameterGrid(unsigned columns, unsigned rows) {
+	Mandelbrot mandelbrot(columns, rows);
+
+	for (unsigned y = 0; y < rows; ++y) {
+		for (unsigned x = 0; x < columns; ++x) {
+			addParameter(mandelbrot.getRe(x), mandelbrot.getIm(y));
+		}
+	}
+}
+
+size_t JuliaBatch::getNumOfThumbnails() {
+	return parametersRe.size();
+}
+
+void JuliaBatch::calculate(std::vector<unsigned int> &escapeTimes) {
+	size_t numOfThumbnails = parametersRe.size();
+	size_t numOfGroups = (numOfThumbnails + lanes - 1) / lanes;
+	size_t pixelsPerThumbnail = (size_t) thumbnailSize * thumbnailSize;
+
+	escapeTimes.assign(numOfThumbnails * pixelsPerThumbnail, 0);
+
+	// same pixel grid for every thumbnail, center 0 + 0i on pixel (size/2|size/2)
+	double scale = 4.0 / thumbnailSize;
+	double minRe = -scale * (thumbnailSize / 2);
+	double maxIm = scale * (thumbnailSize / 2);
+
+	// one work item = one row of a group of thumbnails
+	std::atomic<size_t> nextItem(0);
+	size_t numOfItems = numOfGroups * thumbnailSize;
+
+	std::vector<std::thread> workers;
+
+	for (int i = 0; i < numOfThreads; i++) {
+		workers.push_back(std::thread([&]() {
+			// all lanes are doubles (also the counters) -> same vector width for every operation, so gcc vectorizes
+			// the lane loop with the baseline SSE2 as well
+			double Z_re[lanes], Z_im[lanes], c_re[lanes], c_im[lanes], count[lanes], bounded[lanes];
+
+			for (size_t item = nextItem++; item < numOfItems; item = nextItem++) {
+				size_t group = item / thumbnailSize;
+				unsigned y = item % thumbnailSize;
+
+				// parameters of the group, missing thumbnails of the last group repeat the last parameter
+				for (int l = 0; l < lanes; ++l) {
+					size_t thumbnail = std::min(group * lanes + l, numOfThumbnails - 1);
+					c_re[l] = parametersRe[thumbnail];
+					c_im[l] = parametersIm[thumbnail];
+				}
+
+				for (unsigned x = 0; x < thumbnailSize; ++x) {
+					for (int l = 0; l < lanes; ++l) {
+						Z_re[l] = minRe + x * scale;
+						Z_im[l] = maxIm - y * scale;
+						count[l] = 0.0;
+						bounded[l] = 1.0;
+					}
+
+					for (int n = 0; n < iterations; ++n) {
+						double active = 0.0;
+
+						// no branches -> one vector instruction per operation for all lanes; escaped lanes keep iterating
+						// (up to inf / nan), but bounded stays 0 and their count does not change anymore;
+						// not unrolled, otherwise gcc unrolls the 8 lanes before the loop vectorizer sees them
+						#pragma GCC unroll 1
+						for (int l = 0; l < lanes; ++l) {
+							double re = Z_re[l], im = Z_im[l];
+							double Z_re2 = re * re, Z_im2 = im * im;
+
+							bounded[l] = (Z_re2 + Z_im2 <= 4) ? bounded[l] : 0.0;
+							count[l] += bounded[l];
+							active += bounded[l];
+
+							Z_re[l] = Z_re2 - Z_im2 + c_re[l];
+							Z_im[l] = 2 * re * im + c_im[l];
+						}
+
+						if (active == 0.0) {
+							break;
+						}
+					}
+
+					for (int l = 0; l < lanes; ++l) {
+						size_t thumbnail = group * lanes + l;
+
+						if (thumbnail < numOfThumbnails) {
+							escapeTimes[thumbnail * pixelsPerThumbnail + y * thumbnailSize + x] = (unsigned int) count[l];
+						}
+					}
+				}
+			}
+		}));
+	}
+
+	for (auto &th : workers) {
+		th.join();
+	}
+}
+
+void JuliaBatch::renderAtlas(unsigned columns, const std::string &filename) {
+	if (columns == 0 || parametersRe.empty()) {
+		std::cout << "error: The atlas needs at least one column and one parameter." << std::endl;
+		return;
+	}
+
+	size_t numOfThumbnails = parametersRe.size();
+	unsigned rows = (numOfThumbnails + columns - 1) / columns;
+	size_t pixelsPerThumbnail = (size_t) thumbnailSize * thumbnailSize;
+
+	std::cout << "Calculating " << numOfThumbnails << " Julia sets (" << thumbnailSize << "x" << thumbnailSize << ") with "
+			  << numOfThreads << " threads ..." << std::endl;
+
+	auto start = std::chrono::steady_clock::now();
+
+	std::vector<unsigned int> escapeTimes;
+	calculate(escapeTimes);
+
+	std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+	std::cout << "done in " << time.count() << "s.\n" << std::endl;
+
+	PPMImage atlas(rows * thumbnailSize, columns * thumbnailSize);
+
+	for (size_t y = 0; y < atlas.height(); ++y) {
+		for (size_t x = 0; x < atlas.width(); ++x) {
+			atlas[y][x].r = 0;
+			atlas[y][x].g = 0;
+			atlas[y][x].b = 0;
+		}
+	}
+
+	for (size_t t = 0; t < numOfThumbnails; ++t) {
+		size_t offsetX = (t % columns) * thumbnailSize;
+		size_t offsetY = (t / columns) * thumbnailSize;
+
+		for (unsigned y = 0; y < thumbnailSize; ++y) {
+			for (unsigned x = 0; x < thumbnailSize; ++x) {
+				unsigned int n = escapeTimes[t * pixelsPerThumbnail + y * thumbnailSize + x];
+				unsigned int value = (n == (unsigned int) iterations) ? 0 : n;
+
+				atlas[offsetY + y][offsetX + x].r = value;
+				atlas[offsetY + y][offsetX + x].g = value;
+				atlas[offsetY + y][offsetX + x].b = value;
+			}
+		}
+	}
+
+	atlas.setMaxValue(std::max(1, std::min(iterations, 65535)));
+	atlas.save(filename);
+}
+
+void JuliaBatch::renderThumbnails(const std::string &filenamePrefix) {
+	size_t numOfThumbnails = parametersRe.size();
+	size_t pixelsPerThumbnail = (size_t) thumbnailSize * thumbnailSize;
+
+	std::vector<unsigned int> escapeTimes;
+	calculate(escapeTimes);
+
+	PPMImage thumbnail(thumbnailSize, thumbnailSize);
+	thumbnail.setMaxValue(std::max(1, std::min(iterations, 65535)));
+
+	for (size_t t = 0; t < numOfThumbnails; ++t) {
+		for (unsigned y = 0; y < thumbnailSize; ++y) {
+			for (unsigned x = 0; x < thumbnailSize; ++x) {
+				unsigned int n = escapeTimes[t * pixelsPerThumbnail + y * thumbnailSize + x];
+				unsigned int value = (n == (unsigned int) iterations) ? 0 : n;
+
+				thumbnail[y][x].r = value;
+				thumbnail[y][x].g = value;
+				thumbnail[y][x].b = value;
+			}
+		}
+
+		thumbnail.save(filenamePrefix + "-" + std::to_string(t) + ".ppm");
+	}
+}
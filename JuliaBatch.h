@@ -0,0 +1,87 @@
+/*
+ * JuliaBatch.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ *  src:
+ *
+ *  [1]	https://en.wikipedia.org/wiki/Julia_set
+ *  [2] https://gcc.gnu.org/projects/tree-ssa/vectorization.html
+ *  [3] https://en.wikipedia.org/wiki/Texture_atlas
+ */
+
+#ifndef JULIABATCH_H_
+#define JULIABATCH_H_
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "PPMImage.h"
+
+class JuliaBatch {
+  public:
+	/** number of thumbnails which are calculated together; lane l of the iteration holds the same pixel of thumbnail l
+	 *  of a group, so the inner loop over the lanes has no dependencies and is vectorized by the compiler (-O3)
+	 */
+	static const int lanes = 8;
+
+	/** constructor; every thumbnail shows -2 ... 2 on both axes with thumbnailSize x thumbnailSize pixels
+	 *
+	 *  @param	specify the size of the thumbnails
+	 *  @param	specify the number of threads and iterations
+	 *  @return ---
+	*/
+	JuliaBatch(unsigned thumbnailSize, int numOfThreads, int iterations);
+
+	/** function to append a parameter c to the batch
+	 *
+	 *  @param	specify the real and imaginary part of c
+	 *  @return ---
+	*/
+	void addParameter(double c_re, double c_im);
+
+	/** function to append columns x rows parameters c, sampled from the pixel grid of the default viewport of the
+	 * 	Mandelbrot class (row by row)
+	 *
+	 *  @param	specify the number of columns and rows
+	 *  @return ---
+	*/
+	void addParameterGrid(unsigned columns, unsigned rows);
+
+	/** function to render all thumbnails into one atlas image; thumbnail i is placed in column (i % columns) and
+	 * 	row (i / columns). The color value of a pixel is its escape time, pixels inside the Julia set are black.
+	 *
+	 *  @param	specify the number of columns of the atlas
+	 *  @param	specify the filename of the atlas
+	 *  @return ---
+	*/
+	void renderAtlas(unsigned columns, const std::string &filename);
+
+	/** function to render every thumbnail to its own file "filenamePrefix-i.ppm"
+	 *
+	 *  @param	specify the prefix of the filenames
+	 *  @return ---
+	*/
+	void renderThumbnails(const std::string &filenamePrefix);
+
+	size_t getNumOfThumbnails();
+
+	/** function to calculate the escape times of all thumbnails with one pool of numOfThreads threads; the work items
+	 * 	(one row of a group of thumbnails) are taken from a shared counter until the batch is done. Pixel (x|y) of
+	 * 	thumbnail t is z0 = (x - size/2) * 4/size + (size/2 - y) * 4/size i.
+	 *
+	 *  @param	---
+	 *  @return &escapeTimes will contain thumbnailSize * thumbnailSize values per thumbnail (thumbnail by thumbnail, in rows)
+	*/
+	void calculate(std::vector<unsigned int> &escapeTimes);
+
+  private:
+
+	unsigned thumbnailSize;
+	int numOfThreads, iterations;
+
+	std::vector<double> parametersRe, parametersIm;
+};
+
+#endif /* JULIABATCH_H_ */
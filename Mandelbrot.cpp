@@ -5,6 +5,12 @@
  *      Author: joseph
  */
 
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include "Mandelbrot.h"
 
 Mandelbrot::Mandelbrot() {
@@ -66,96 +72,156 @@ void Mandelbrot::setCompressionLevel(int numOfCombinedBits) {
 	this->numOfCombinedBits = HelperFunctions::getInstance()->gd(width, numOfCombinedBits);
 }
 
-void Mandelbrot::calculateCompressedImage(std::string &returnBuf) {
+void Mandelbrot::setViewport(double centerRe, double centerIm, double scale) {
+	minRe = centerRe - scale * (width / 2);
+	maxRe = minRe + scale * (width - 1);
+	maxIm = centerIm + scale * (height / 2);
+	minIm = maxIm - scale * (height - 1);
+	shiftRe = 0;
+}
 
-	// fractal properties
-	double MinRe = -1.2;
-	double MaxRe = 1.2;
-	double MinIm = -1.2;
-	double MaxIm = 1.2;
-	double Re_facor = (MaxRe - MinRe) / (width - 1);
-	double Im_factor = (MaxIm - MinIm) / (height - 1);
+void Mandelbrot::setUseTileCache(bool useTileCache) {
+	this->useTileCache = useTileCache;
+}
+
+double Mandelbrot::getRe(unsigned x) {
+	double Re_facor = (maxRe - minRe) / (width - 1);
+	return minRe + x * Re_facor + shiftRe;
+}
 
+double Mandelbrot::getIm(unsigned y) {
+	double Im_factor = (maxIm - minIm) / (height - 1);
+	return maxIm - y * Im_factor;
+}
+
+bool Mandelbrot::isInside(unsigned x, unsigned y) {
+	return escapeTime(getRe(x), getIm(y)) == (unsigned) iterations;
+}
+
+unsigned Mandelbrot::escapeTime(double c_re, double c_im) {
 	// implementation of the mathematical limes -> to infinite (in this case 34)
 	unsigned MaxIterations = this->iterations;
 
-	// compression buffer
-	int bufIndex = 0;
-	int valCoded = 0;
+	double Z_re = c_re, Z_im = c_im;
 
-	for (unsigned y = minY; y < maxY; ++y) {
-		double c_im = MaxIm - y * Im_factor;
+	for (unsigned n = 0; n < MaxIterations; ++n) {
+		double Z_re2 = Z_re * Z_re, Z_im2 = Z_im * Z_im;
 
-		for (unsigned x = minX; x < maxX; ++x) {
-			double c_re = MinRe + x * Re_facor - 0.65; // image on Re-axis move with 0.65
+		if (Z_re2 + Z_im2 > 4) {
+			return n;
+		}
 
-			double Z_re = c_re, Z_im = c_im;
-			bool isInside = true;
+		Z_im = 2 * Z_re * Z_im + c_im;
+		Z_re = Z_re2 - Z_im2 + c_re;
+	}
 
-			for (unsigned n = 0; n < MaxIterations; ++n) {
-				double Z_re2 = Z_re * Z_re, Z_im2 = Z_im * Z_im;
+	return MaxIterations;
+}
 
-				if (Z_re2 + Z_im2 > 4) {
-					isInside = false;
-					break;
-				}
+void Mandelbrot::calculateTile(long long firstX, long long firstY, std::vector<unsigned char> &tile) {
+	unsigned tileSize = TileCache::tileSize;
+	unsigned MaxIterations = this->iterations;
 
-				Z_im = 2 * Z_re * Z_im + c_im;
-				Z_re = Z_re2 - Z_im2 + c_re;
-			}
+	double Re_facor = (maxRe - minRe) / (width - 1);
+	double Im_factor = (maxIm - minIm) / (height - 1);
 
-			if (isInside) {
-				valCoded = (valCoded << 1) + 1;
-			} else {
-				valCoded = (valCoded << 1);
-			}
+	tile.assign(tileSize * tileSize, 0);
 
-			bufIndex++;
+	for (unsigned j = 0; j < tileSize; ++j) {
+		double y = firstY + j;
+		double c_im = maxIm - y * Im_factor;
 
-			if(bufIndex > numOfCombinedBits - 1) {
-				bufIndex = 0;
-				returnBuf += std::to_string(valCoded) + "\n";
-				valCoded = 0;
-			}
+		for (unsigned i = 0; i < tileSize; ++i) {
+			double x = firstX + i;
+			double c_re = minRe + x * Re_facor + shiftRe;
+
+			tile[j * tileSize + i] = (escapeTime(c_re, c_im) == MaxIterations) ? 1 : 0;
 		}
 	}
 }
 
-void Mandelbrot::calculateImage(PPMImage &image) {
+void Mandelbrot::calculateRegion(std::vector<unsigned char> &inside) {
+	unsigned regionWidth = maxX - minX;
+	unsigned MaxIterations = this->iterations;
 
-	// fractal properties
-	double MinRe = -1.2;
-	double MaxRe = 1.2;
-	double MinIm = -1.2;
-	double MaxIm = 1.2;
-	double Re_facor = (MaxRe - MinRe) / (width - 1);
-	double Im_factor = (MaxIm - MinIm) / (height - 1);
+	double Re_facor = (maxRe - minRe) / (width - 1);
+	double Im_factor = (maxIm - minIm) / (height - 1);
 
-	// implementation of the mathematical limes -> to infinite (in this case 34)
-	unsigned MaxIterations = this->iterations;
+	inside.assign(regionWidth * (maxY - minY), 0);
 
-	for (unsigned y = minY; y < maxY; ++y) {
-		double c_im = MaxIm - y * Im_factor;
+	TileCache *cache = TileCache::getInstance();
 
-		for (unsigned x = minX; x < maxX; ++x) {
-			double c_re = MinRe + x * Re_facor - 0.65; // image on Re-axis move with 0.65
+	if (!useTileCache || !cache->isEnabled()) {
+		for (unsigned y = minY; y < maxY; ++y) {
+			double c_im = maxIm - y * Im_factor;
+
+			for (unsigned x = minX; x < maxX; ++x) {
+				double c_re = minRe + x * Re_facor + shiftRe;
+
+				inside[(y - minY) * regionWidth + (x - minX)] = (escapeTime(c_re, c_im) == MaxIterations) ? 1 : 0;
+			}
+		}
+		return;
+	}
 
-			double Z_re = c_re, Z_im = c_im;
-			bool isInside = true;
+	long long tileSize = TileCache::tileSize;
+	std::vector<unsigned char> tile;
 
-			for (unsigned n = 0; n < MaxIterations; ++n) {
-				double Z_re2 = Z_re * Z_re, Z_im2 = Z_im * Z_im;
+	// tiles are aligned to a lattice in the complex plane (not to pixel 0 of the viewport): pixel x lies on lattice column
+	// offsetRe + x, where offsetRe is c_re of pixel 0 in units of the pixel scale. Two viewports with the same pixel scale
+	// whose pixels lie on the same lattice (e.g. panned by whole pixels) therefore share their tiles.
+	double positionRe = (minRe + shiftRe) / Re_facor;
+	double positionIm = -maxIm / Im_factor;
+	long long offsetRe = std::llround(positionRe);
+	long long offsetIm = std::llround(positionIm);
 
-				if (Z_re2 + Z_im2 > 4) {
-					isInside = false;
-					break;
-				}
+	auto floorDiv = [tileSize](long long n) { return (n >= 0) ? n / tileSize : -((-n + tileSize - 1) / tileSize); };
+
+	for (long long tileY = floorDiv(offsetIm + minY); tileY <= floorDiv(offsetIm + maxY - 1); ++tileY) {
+		for (long long tileX = floorDiv(offsetRe + minX); tileX <= floorDiv(offsetRe + maxX - 1); ++tileX) {
+			std::string key = TileCache::makeKey("mandelbrot", Re_facor, Im_factor, positionRe - offsetRe, positionIm - offsetIm,
+					tileX, tileY, iterations);
+
+			// first pixel of the tile on the pixel grid of this viewport (might be outside of the image)
+			long long firstX = tileX * tileSize - offsetRe;
+			long long firstY = tileY * tileSize - offsetIm;
 
-				Z_im = 2 * Z_re * Z_im + c_im;
-				Z_re = Z_re2 - Z_im2 + c_re;
+			if (!cache->lookup(key, tile)) {
+				calculateTile(firstX, firstY, tile);
+				cache->store(key, tile);
 			}
 
-			if (isInside) {
+			// copy the part of the tile which overlaps the part image
+			long long x0 = std::max<long long>(minX, firstX), x1 = std::min<long long>(maxX, firstX + tileSize);
+			long long y0 = std::max<long long>(minY, firstY), y1 = std::min<long long>(maxY, firstY + tileSize);
+
+			for (long long y = y0; y < y1; ++y) {
+				for (long long x = x0; x < x1; ++x) {
+					inside[(y - minY) * regionWidth + (x - minX)] = tile[(y - firstY) * tileSize + (x - firstX)];
+				}
+			}
+		}
+	}
+}
+
+void Mandelbrot::calculateCompressedImage(std::string &returnBuf) {
+	std::vector<unsigned char> inside;
+
+	calculateRegion(inside);
+
+	HelperFunctions::getInstance()->combineBits(inside, numOfCombinedBits, returnBuf);
+}
+
+void Mandelbrot::calculateImage(PPMImage &image) {
+	std::vector<unsigned char> inside;
+
+	calculateRegion(inside);
+
+	unsigned regionWidth = maxX - minX;
+
+	for (unsigned y = minY; y < maxY; ++y) {
+		for (unsigned x = minX; x < maxX; ++x) {
+			if (inside[(y - minY) * regionWidth + (x - minX)]) {
 				// rotating the image (left orientated) -> x and y change
 				image[y][x].r = 0;
 				image[y][x].g = 0;
@@ -169,6 +235,110 @@ void Mandelbrot::calculateImage(PPMImage &image) {
 	}
 }
 
+TileStream Mandelbrot::streamTiles(unsigned tileWidth, unsigned tileHeight, unsigned lookahead) const {
+	if (tileWidth == 0 || tileHeight == 0 || lookahead == 0) {
+		std::cout << "error: Tile size and lookahead have to be at least 1, using 1." << std::endl;
+	}
+
+	return generateTiles(*this, std::max(1u, tileWidth), std::max(1u, tileHeight), std::max(1u, lookahead));
+}
+
+// state shared by the coroutine of streamTiles() and its workers; slot k % lookahead holds tile k
+struct TileQueue
+{
+	std::mutex mtx;
+	std::condition_variable cv;
+
+	std::vector<Tile> slots;
+	std::vector<bool> finished;
+
+	// next tile to compute, number of tiles pulled by the consumer, number of tiles
+	size_t next = 0, pulled = 0, total = 0;
+	bool stop = false;
+
+	std::vector<std::thread> workers;
+
+	// the stream is destroyed (done or abandoned by the consumer) -> stop and join the workers
+	~TileQueue() {
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			stop = true;
+		}
+		cv.notify_all();
+
+		for (auto &th : workers) {
+			th.join();
+		}
+	}
+};
+
+TileStream Mandelbrot::generateTiles(Mandelbrot region, unsigned tileWidth, unsigned tileHeight, unsigned lookahead) {
+	size_t tilesX = (region.maxX - region.minX + tileWidth - 1) / tileWidth;
+	size_t tilesY = (region.maxY - region.minY + tileHeight - 1) / tileHeight;
+
+	TileQueue queue;
+	queue.total = tilesX * tilesY;
+	queue.slots.resize(lookahead);
+	queue.finished.assign(lookahead, false);
+
+	// lookahead persistent workers; a worker only starts tile k if tile k - lookahead was pulled already
+	for (size_t i = 0; i < std::min((size_t) lookahead, queue.total); i++) {
+		queue.workers.push_back(std::thread([&queue, &region, tilesX, tileWidth, tileHeight, lookahead]() {
+			while (true) {
+				size_t k = 0;
+
+				{
+					std::unique_lock<std::mutex> lock(queue.mtx);
+					queue.cv.wait(lock, [&]() {
+						return queue.stop || queue.next >= queue.total || queue.next < queue.pulled + lookahead;
+					});
+
+					if (queue.stop || queue.next >= queue.total) {
+						return;
+					}
+
+					k = queue.next++;
+				}
+
+				Mandelbrot part = region;
+				part.minX = region.minX + (k % tilesX) * tileWidth;
+				part.maxX = std::min(region.maxX, part.minX + tileWidth);
+				part.minY = region.minY + (k / tilesX) * tileHeight;
+				part.maxY = std::min(region.maxY, part.minY + tileHeight);
+
+				Tile tile = { part.minX, part.maxX, part.minY, part.maxY, {} };
+				part.calculateRegion(tile.inside);
+
+				{
+					std::lock_guard<std::mutex> lock(queue.mtx);
+					queue.slots[k % lookahead] = std::move(tile);
+					queue.finished[k % lookahead] = true;
+				}
+				queue.cv.notify_all();
+			}
+		}));
+	}
+
+	for (size_t k = 0; k < queue.total; ++k) {
+		Tile tile;
+
+		{
+			std::unique_lock<std::mutex> lock(queue.mtx);
+			queue.cv.wait(lock, [&]() { return queue.finished[k % lookahead]; });
+
+			tile = std::move(queue.slots[k % lookahead]);
+			queue.finished[k % lookahead] = false;
+			queue.pulled = k + 1;
+		}
+
+		// the workers continue with the next tile while the consumer processes this one, but the coroutine is
+		// suspended in co_yield until the consumer pulls again, so no more than lookahead tiles are computed ahead
+		queue.cv.notify_all();
+
+		co_yield std::move(tile);
+	}
+}
+
 void Mandelbrot::createPPMFile(std::string &filename) {
 	std::cout << "Creating PPM image file " << width << "x" << height << std::endl;
 
@@ -9,14 +9,18 @@
  *  [1]	http://warp.povusers.org/Mandelbrot/
  *  [2]	https://medium.com/farouk-ounanes-home-on-the-internet/mandelbrot-set-in-c-from-scratch-c7ad6a1bf2d9
  *  [3] https://stackoverflow.com/questions/53381279/mandelbrot-image-generator-in-c-using-multi-threading-overwrites-half-the
+ *  [4] https://en.wikipedia.org/wiki/Cache_replacement_policies#Least_recently_used_(LRU)
  */
 
 #ifndef MANDELBROT_H_
 #define MANDELBROT_H_
 
 #include <iostream>
+#include <vector>
 #include "HelperFunctions.h"
 #include "PPMImage.h"
+#include "TileCache.h"
+#include "TileStream.h"
 
 class Mandelbrot {
 public:
@@ -74,8 +78,51 @@ public:
 	*/
 	void setCompressionLevel(int numOfCombinedBits);
 
+	/** function to move the viewport of the image in the complex plane. The center of the viewport lies on pixel (width/2|height/2),
+	 * 	every pixel covers scale x scale of the complex plane. Without calling this function, the image shows the default
+	 * 	viewport from (-1.85|-1.2) to (0.55|1.2).
+	 *
+	 *  @param	specify the center of the viewport (real and imaginary part)
+	 *  @param	specify the pixel scale (size of one pixel in the complex plane)
+	 *  @return ---
+	*/
+	void setViewport(double centerRe, double centerIm, double scale);
+
+	/** function to bypass the TileCache for this object (e.g. renders with their own cache, whose tiles would only evict the
+	 * 	tiles of the other render paths); the cache is used by default, if it is enabled.
+	 *
+	 *  @param	false to compute every pixel of this object without looking up or storing tiles
+	 *  @return ---
+	*/
+	void setUseTileCache(bool useTileCache);
+
+	/** functions to get the point c of the complex plane, which belongs to the column x or row y of the image
+	 *
+	 *  @param	specify the column x or the row y of the image
+	 *  @return real part of c (column x), imaginary part of c (row y)
+	*/
+	double getRe(unsigned x);
+
+	double getIm(unsigned y);
+
+	/** function to iterate z = z^2 + c for a single point c of the complex plane
+	 *
+	 *  @param	specify the real and imaginary part of c
+	 *  @return the iteration in which z escaped (|z| > 2), the number of iterations if c is part of the mandelbrot set
+	*/
+	unsigned escapeTime(double c_re, double c_im);
+
+	/** function to calculate a single pixel of the image (independent from minX, maxX, minY and maxY and the TileCache)
+	 *
+	 *  @param	specify the pixel (x|y)
+	 *  @return true if the pixel is part of the mandelbrot set
+	*/
+	bool isInside(unsigned x, unsigned y);
+
 	/** function to calculate a part image of the mandelbrot fractal between minX, maxX, minY and maxY; the result will be returned as
 	 * 	an compressed string, which contains a stream of int values regarding to maximum available value (2^numOfCombinedBits).
+	 * 	Already computed tiles are taken from the TileCache, so re-encoding the same image with another compression level
+	 * 	costs no computation.
 	 *
 	 *  @param	specify the number of combined bits in the bitstream of the *.ppm file
 	 *  @return &returnBuf will contain the int data stream of the part row picture
@@ -83,14 +130,35 @@ public:
 	void calculateCompressedImage(std::string &returnBuf);
 
 
+
 	/** function to calculate a part image of the mandelbrot fractal between minX, maxX, minY and maxY; the result will be stored in
 	 * 	matrix, which is a property of the reference of the PPMImage @param; the the matrix will contain rgb values.
+	 * 	Already computed tiles are taken from the TileCache.
 	 *
 	 *  @param	pass the reference to the PPMImage to store the result
 	 *  @return &image will contain the points of the mandelbrot fractal in form of a matrix
 	*/
 	void calculateImage(PPMImage &image);
 
+	/** function to calculate the part image between minX, maxX, minY and maxY; tiles which are already known will be taken
+	 * 	from the TileCache, missing tiles are computed and stored in the cache.
+	 *
+	 *  @param	---
+	 *  @return &inside will contain 1 (inside) or 0 (outside) for each pixel of the part image in rows
+	*/
+	void calculateRegion(std::vector<unsigned char> &inside);
+
+	/** function to calculate the part image between minX, maxX, minY and maxY as a stream of tiles (tileWidth x tileHeight,
+	 * 	clipped at the borders, row by row). Nothing is computed before the first next(); then lookahead worker threads compute
+	 * 	at most lookahead tiles ahead of the consumer, so a slow consumer throttles the computation and the memory stays bounded.
+	 * 	The stream uses a copy of this object and stays valid after this object is destroyed.
+	 *
+	 *  @param	specify the tile width and height
+	 *  @param	specify the number of tiles which are computed ahead (= number of worker threads)
+	 *  @return stream of the finished tiles
+	*/
+	TileStream streamTiles(unsigned tileWidth, unsigned tileHeight, unsigned lookahead) const;
+
 	/** ...
 	 *
 	 *  @param
@@ -106,12 +174,32 @@ public:
 	void writeToPPMFile(std::string &filename, std::string &content);
 
 private:
+	/** function to calculate one tile (TileCache::tileSize x TileCache::tileSize pixels) of the pixel grid; the tile might
+	 * 	exceed the image borders (even start at negative pixel coordinates), the pixels are still valid points of the grid.
+	 *
+	 *  @param	specify the first pixel (firstX|firstY) of the tile on the pixel grid of the viewport
+	 *  @return &tile will contain 1 (inside) or 0 (outside) for each pixel in rows
+	*/
+	void calculateTile(long long firstX, long long firstY, std::vector<unsigned char> &tile);
+
+	// coroutine of streamTiles(), the parameters (and the copy of the object) live in the coroutine frame
+	static TileStream generateTiles(Mandelbrot region, unsigned tileWidth, unsigned tileHeight, unsigned lookahead);
+
 	unsigned width;
 	unsigned height;
 
 	unsigned minX, maxX, minY, maxY;
 
 	int numOfCombinedBits, iterations;
+
+	bool useTileCache = true;
+
+	// fractal properties
+	double minRe = -1.2;
+	double maxRe = 1.2;
+	double minIm = -1.2;
+	double maxIm = 1.2;
+	double shiftRe = -0.65; // image on Re-axis move with 0.65
 };
 
 #endif /* MANDELBROT_H_ */
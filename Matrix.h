@@ -2,6 +2,8 @@
 #define MATRIX_H_
 
 #include <iostream>
+#include <mutex>
+#include <vector>
 
 template <class T>
 struct RGB
@@ -20,10 +22,26 @@ class Matrix {
         }
     }
 
+    // rows are not allocated until allocateRows() is called -> the memory of a row is first touched
+    // by the thread which writes it (NUMA first touch); rows which were never allocated must not be
+    // accessed with operator[]
+    Matrix(const size_t rows, const size_t cols, bool deferAllocation) : _rows(rows), _cols(cols) {
+        _matrix = new T *[rows];
+        for (size_t i = 0; i < rows; ++i)
+        {
+            _matrix[i] = deferAllocation ? nullptr : new T[cols];
+        }
+    }
+
     Matrix(const Matrix &m) : _rows(m._rows), _cols(m._cols) {
         _matrix = new T *[m._rows];
 
         for (size_t i = 0; i < m._rows; ++i) {
+            if (m._matrix[i] == nullptr) {
+                _matrix[i] = nullptr;
+                continue;
+            }
+
             _matrix[i] = new T[m._cols];
 
             for (size_t j = 0; j < m._cols; ++j) {
@@ -39,6 +57,40 @@ class Matrix {
         delete[] _matrix;
     }
 
+    // allocates the rows begin ... end-1, which are not allocated yet (initialized with 0); has to be
+    // called by the thread which will write the rows. The rows are allocated and zeroed outside of the
+    // lock, so threads which allocate different rows do not wait for each other.
+    void allocateRows(const size_t begin, const size_t end) {
+        std::vector<size_t> missing;
+
+        {
+            std::lock_guard<std::mutex> lock(_allocation);
+
+            for (size_t i = begin; i < end && i < _rows; ++i) {
+                if (_matrix[i] == nullptr) {
+                    missing.push_back(i);
+                }
+            }
+        }
+
+        std::vector<T *> rows;
+
+        for (size_t i = 0; i < missing.size(); ++i) {
+            rows.push_back(new T[_cols]());
+        }
+
+        std::lock_guard<std::mutex> lock(_allocation);
+
+        for (size_t i = 0; i < missing.size(); ++i) {
+            // another thread might have allocated the row in the meantime
+            if (_matrix[missing[i]] == nullptr) {
+                _matrix[missing[i]] = rows[i];
+            } else {
+                delete[] rows[i];
+            }
+        }
+    }
+
     T *operator[](const size_t nIndex) {
         return _matrix[nIndex];
     }
@@ -50,6 +102,7 @@ class Matrix {
   protected:
     size_t _rows, _cols;
     T **_matrix;
+    std::mutex _allocation;
 };
 
 #endif /* MATRIX_H_ */
@@ -9,24 +9,35 @@
 
 PPMImage::PPMImage(const size_t height, const size_t width) : Matrix(height, width) { }
 
+PPMImage::PPMImage(const size_t height, const size_t width, bool firstTouch) : Matrix(height, width, firstTouch) { }
+
 void PPMImage::save(const std::string &filename) {
 	std::cout << "Saving to image " << filename << " ..." << std::endl;
 
+	// rows of a first touch image, which were never calculated (e.g. canceled render)
+	allocateRows(0, height());
+
 	std::ofstream out(filename);
 	out << "P3" << std::endl
 		<< _cols << " " << _rows << std::endl
-		<< 1 << std::endl << std::endl;
+		<< maxValue << std::endl << std::endl;
 	for (size_t y = 0; y < _rows; y++)
 		for (size_t x = 0; x < _cols; x++)
-			out << _matrix[y][x].r << " " << _matrix[y][x].g << " " << _matrix[y][x].b << std::endl;
+			out << _matrix[y][x].r << " " << _matrix[y][x].g << " " << _matrix[y][x].b << "\n";
 
 	std::cout << "done.\n" << std::endl;
 }
 
+void PPMImage::setMaxValue(unsigned int maxValue) {
+	this->maxValue = maxValue;
+}
+
 void PPMImage::codeImg(const std::string &filename) {
 
 	std::cout << "Compressing and saving to coded image " << filename << " ..." << std::endl;
 
+	allocateRows(0, height());
+
 	std::ofstream out(filename);
 	out << "P3" << std::endl
 		<< _cols << " " << _rows << std::endl
@@ -25,14 +25,21 @@ class PPMImage : public Matrix< RGB<unsigned int> > {
   public:
     PPMImage(const size_t height, const size_t width);
 
+    // the rows have to be allocated with allocateRows() by the threads, which calculate them (NUMA first touch)
+    PPMImage(const size_t height, const size_t width, bool firstTouch);
+
     void save(const std::string &filename);
 
+    // maximum value of a color in the *.ppm file (default 1 -> black / white)
+    void setMaxValue(unsigned int maxValue);
+
     void codeImg(const std::string &filename);
 
     void decodeImg(const std::string &inputFile, const std::string &filename);
 
   private:
     int compressionLevel = 30;
+    unsigned int maxValue = 1;
 };
 
 #endif /* PPMIMAGE_H_ */
@@ -0,0 +1,350 @@
+/*
+ * PackedBitmap.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "HelperFunctions.h"
+#include "PackedBitmap.h"
+
+PackedBitmap::PackedBitmap(unsigned width, unsigned height) {
+	this->width = width;
+	this->height = height;
+	this->wordsPerRow = (width + 63) / 64;
+
+	words.assign(wordsPerRow * height, 0);
+}
+
+// reverses the order of the lowest numOfBits bits of value (1 ... 64)
+static uint64_t reverseBits(uint64_t value, int numOfBits) {
+	value = ((value >> 1) & 0x5555555555555555ull) | ((value & 0x5555555555555555ull) << 1);
+	value = ((value >> 2) & 0x3333333333333333ull) | ((value & 0x3333333333333333ull) << 2);
+	value = ((value >> 4) & 0x0f0f0f0f0f0f0f0full) | ((value & 0x0f0f0f0f0f0f0f0full) << 4);
+	value = ((value >> 8) & 0x00ff00ff00ff00ffull) | ((value & 0x00ff00ff00ff00ffull) << 8);
+	value = ((value >> 16) & 0x0000ffff0000ffffull) | ((value & 0x0000ffff0000ffffull) << 16);
+	value = (value >> 32) | (value << 32);
+
+	return value >> (64 - numOfBits);
+}
+
+void PackedBitmap::append(uint64_t &index, uint64_t value, int numOfBits) {
+	if (numOfBits <= 0) {
+		return;
+	}
+
+	// the first pixel is the most significant bit of the value, but the lowest bit of a word
+	uint64_t bits = reverseBits(value, std::min(numOfBits, 64));
+	uint64_t size = (uint64_t) width * height;
+
+	// copy the bits in pieces, which end at the end of a word or a row
+	while (numOfBits > 0 && index < size) {
+		unsigned x = index % width, y = index / width;
+		unsigned shift = x % 64;
+		int count = std::min({ numOfBits, 64 - (int) shift, (int) (width - x) });
+
+		uint64_t mask = (count == 64) ? ~0ull : (1ull << count) - 1;
+		uint64_t &word = words[y * wordsPerRow + x / 64];
+
+		word = (word & ~(mask << shift)) | ((bits & mask) << shift);
+
+		bits = (count == 64) ? 0 : bits >> count;
+		numOfBits -= count;
+		index += count;
+	}
+
+	// bits behind the end of the image
+	index += numOfBits;
+}
+
+bool PackedBitmap::load(const std::string &filename) {
+	std::ifstream in(filename);
+	std::string line = "";
+
+	if (!in.is_open()) {
+		std::cout << "Unable to open file" << std::endl;
+		return false;
+	}
+
+	// header: "P3", "width height", max color value
+	unsigned w = 0, h = 0;
+
+	if (!std::getline(in, line) || !std::getline(in, line)) {
+		std::cout << "error: " << filename << " is not a *.ppm file." << std::endl;
+		return false;
+	}
+
+	std::stringstream size(line);
+	size >> w >> h;
+	std::getline(in, line);
+
+	std::vector<uint64_t> values;
+	uint64_t maxValue = 0;
+	unsigned lineNumber = 3;
+
+	while (std::getline(in, line)) {
+		lineNumber++;
+
+		if (line.find_first_not_of(" \t\r") == std::string::npos) {
+			continue;
+		}
+
+		// exactly one number per line, an uncompressed image has three ("1 0 0")
+		char *end = nullptr;
+		errno = 0;
+		uint64_t value = strtoull(line.c_str(), &end, 10);
+
+		if (end == line.c_str() || line.find_first_not_of(" \t\r", end - line.c_str()) != std::string::npos
+				|| line.find('-') != std::string::npos || errno == ERANGE) {
+			std::cout << "error: " << filename << " is not a compressed *.ppm file (line " << lineNumber << ": \""
+					  << line << "\")." << std::endl;
+			return false;
+		}
+
+		values.push_back(value);
+		maxValue = std::max(maxValue, value);
+	}
+
+	if (values.empty() || ((uint64_t) w * h) % values.size() != 0 || ((uint64_t) w * h) / values.size() > 32) {
+		std::cout << "error: " << filename << " is not a compressed *.ppm file (" << values.size() << " values for "
+				  << w << "x" << h << " pixels)." << std::endl;
+		return false;
+	}
+
+	int numOfCombinedBits = (int) (((uint64_t) w * h) / values.size());
+
+	// every value has to fit into the derived number of bits
+	if (maxValue >> numOfCombinedBits != 0) {
+		std::cout << "error: " << filename << " is not a compressed *.ppm file (value " << maxValue << " does not fit into "
+				  << numOfCombinedBits << " bits)." << std::endl;
+		return false;
+	}
+
+	*this = PackedBitmap(w, h);
+
+	uint64_t index = 0;
+	for (uint64_t value : values) {
+		append(index, value, numOfCombinedBits);
+	}
+
+	return true;
+}
+
+bool PackedBitmap::read(const std::string &stream, int numOfCombinedBits) {
+	std::fill(words.begin(), words.end(), 0);
+
+	std::stringstream in(stream);
+	std::string line = "";
+	uint64_t index = 0;
+
+	while (std::getline(in, line)) {
+		if (line != "") {
+			append(index, strtoull(line.c_str(), nullptr, 10), numOfCombinedBits);
+		}
+	}
+
+	return index == (uint64_t) width * height;
+}
+
+void PackedBitmap::save(const std::string &filename, int numOfCombinedBits) {
+	int numOfCombined = HelperFunctions::getInstance()->gd(width, numOfCombinedBits);
+
+	std::ofstream out(filename);
+	out << "P3" << std::endl
+		<< width << " " << height << std::endl
+		<< 1 << std::endl << std::endl;
+
+	for (unsigned y = 0; y < height; ++y) {
+		for (unsigned x = 0; x < width; x += numOfCombined) {
+			uint64_t valCoded = 0;
+
+			for (int i = 0; i < numOfCombined; ++i) {
+				valCoded = (valCoded << 1) + (get(x + i, y) ? 1 : 0);
+			}
+
+			out << valCoded << "\n";
+		}
+	}
+}
+
+PackedBitmap PackedBitmap::diff(const PackedBitmap &other) const {
+	if (width != other.width || height != other.height) {
+		std::cout << "error: Bitmaps of different size (" << width << "x" << height << " and " << other.width << "x" << other.height << ")." << std::endl;
+		return PackedBitmap(0, 0);
+	}
+
+	PackedBitmap result(width, height);
+
+	for (size_t i = 0; i < words.size(); ++i) {
+		result.words[i] = words[i] ^ other.words[i];
+	}
+
+	return result;
+}
+
+PackedBitmap PackedBitmap::intersect(const PackedBitmap &other) const {
+	if (width != other.width || height != other.height) {
+		std::cout << "error: Bitmaps of different size (" << width << "x" << height << " and " << other.width << "x" << other.height << ")." << std::endl;
+		return PackedBitmap(0, 0);
+	}
+
+	PackedBitmap result(width, height);
+
+	for (size_t i = 0; i < words.size(); ++i) {
+		result.words[i] = words[i] & other.words[i];
+	}
+
+	return result;
+}
+
+PackedBitmap PackedBitmap::merge(const PackedBitmap &other) const {
+	if (width != other.width || height != other.height) {
+		std::cout << "error: Bitmaps of different size (" << width << "x" << height << " and " << other.width << "x" << other.height << ")." << std::endl;
+		return PackedBitmap(0, 0);
+	}
+
+	PackedBitmap result(width, height);
+
+	for (size_t i = 0; i < words.size(); ++i) {
+		result.words[i] = words[i] | other.words[i];
+	}
+
+	return result;
+}
+
+uint64_t PackedBitmap::countDifferences(const PackedBitmap &other) const {
+	if (width != other.width || height != other.height) {
+		std::cout << "error: Bitmaps of different size (" << width << "x" << height << " and " << other.width << "x" << other.height << ")." << std::endl;
+		return (uint64_t) -1;
+	}
+
+	uint64_t count = 0;
+
+	// simple loop over the words -> the compiler can use (vector) popcount instructions
+	for (size_t i = 0; i < words.size(); ++i) {
+		count += std::popcount(words[i] ^ other.words[i]);
+	}
+
+	return count;
+}
+
+uint64_t PackedBitmap::popcount() const {
+	uint64_t count = 0;
+
+	for (size_t i = 0; i < words.size(); ++i) {
+		count += std::popcount(words[i]);
+	}
+
+	return count;
+}
+
+PackedBitmap PackedBitmap::crop(unsigned x, unsigned y, unsigned width, unsigned height) const {
+	// clip the part to the bitmap
+	x = std::min(x, this->width);
+	y = std::min(y, this->height);
+	width = std::min(width, this->width - x);
+	height = std::min(height, this->height - y);
+
+	PackedBitmap result(width, height);
+
+	if (width == 0 || height == 0) {
+		return result;
+	}
+
+	size_t firstWord = x / 64;
+	unsigned shift = x % 64;
+
+	for (unsigned row = 0; row < height; ++row) {
+		const uint64_t *src = &words[(y + row) * wordsPerRow];
+		uint64_t *dst = &result.words[row * result.wordsPerRow];
+
+		// every word of the part consists of the upper bits of one word and the lower bits of the next word
+		for (size_t j = 0; j < result.wordsPerRow; ++j) {
+			size_t w = firstWord + j;
+			uint64_t value = src[w] >> shift;
+
+			if (shift != 0 && w + 1 < wordsPerRow) {
+				value |= src[w + 1] << (64 - shift);
+			}
+
+			dst[j] = value;
+		}
+
+		// unused bits of the last word have to be 0
+		if (width % 64 != 0) {
+			dst[result.wordsPerRow - 1] &= (1ull << (width % 64)) - 1;
+		}
+	}
+
+	return result;
+}
+
+PackedBitmap PackedBitmap::downsample(unsigned factor) const {
+	if (factor == 0 || factor > 64) {
+		std::cout << "error: Downsample factor has to be 1 ... 64." << std::endl;
+		return PackedBitmap(0, 0);
+	}
+
+	PackedBitmap result(width / factor, height / factor);
+	std::vector<uint64_t> rows(wordsPerRow);
+
+	uint64_t mask = (factor == 64) ? ~0ull : (1ull << factor) - 1;
+
+	for (unsigned y = 0; y < result.height; ++y) {
+		// combine the rows of the block word by word
+		std::fill(rows.begin(), rows.end(), 0);
+
+		for (unsigned r = 0; r < factor; ++r) {
+			const uint64_t *src = &words[(y * factor + r) * wordsPerRow];
+
+			for (size_t j = 0; j < wordsPerRow; ++j) {
+				rows[j] |= src[j];
+			}
+		}
+
+		// any bit of the columns of the block
+		for (unsigned x = 0; x < result.width; ++x) {
+			uint64_t bit = (uint64_t) x * factor;
+			size_t w = bit / 64;
+			unsigned shift = bit % 64;
+
+			uint64_t block = rows[w] >> shift;
+
+			if (shift + factor > 64 && w + 1 < wordsPerRow) {
+				block |= rows[w + 1] << (64 - shift);
+			}
+
+			if ((block & mask) != 0) {
+				result.words[y * result.wordsPerRow + x / 64] |= 1ull << (x % 64);
+			}
+		}
+	}
+
+	return result;
+}
+
+bool PackedBitmap::get(unsigned x, unsigned y) const {
+	return (words[y * wordsPerRow + x / 64] >> (x % 64)) & 1;
+}
+
+void PackedBitmap::set(unsigned x, unsigned y, bool value) {
+	if (value) {
+		words[y * wordsPerRow + x / 64] |= 1ull << (x % 64);
+	} else {
+		words[y * wordsPerRow + x / 64] &= ~(1ull << (x % 64));
+	}
+}
+
+unsigned PackedBitmap::getWidth() const {
+	return width;
+}
+
+unsigned PackedBitmap::getHeight() const {
+	return height;
+}
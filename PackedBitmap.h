@@ -0,0 +1,120 @@
+/*
+ * PackedBitmap.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ *  src:
+ *
+ *  [1]	https://en.cppreference.com/w/cpp/numeric/popcount
+ *  [2] https://en.wikipedia.org/wiki/Bit_array
+ *  [3] http://0x80.pl/articles/sse-popcount.html
+ */
+
+#ifndef PACKEDBITMAP_H_
+#define PACKEDBITMAP_H_
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+class PackedBitmap {
+  public:
+	/** constructor; creates an empty (all bits 0) bitmap of width x height bits, every row starts with a new 64 bit word
+	 *
+	 *  @param	specify the width and height
+	 *  @return ---
+	*/
+	PackedBitmap(unsigned width, unsigned height);
+
+	/** function to read a compressed *.ppm file (see PPMImage::codeImg() and createMandelbrotImageCompressed() in RenderPaths.h)
+	 * 	into the bitmap without creating the rgb matrix. The number of combined bits is derived from the number of values
+	 * 	in the file, so files of every compression level can be read and compared with each other. Files with more than one
+	 * 	number in a line (uncompressed *.ppm) or values which do not fit into the derived number of bits are rejected.
+	 *
+	 * 	Note: a bit keeps the meaning of the bit in the file, in files of calculateCompressedImage() 1 = inside, in files
+	 * 	of codeImg() 1 = outside (red channel of calculateImage()).
+	 *
+	 *  @param	specify the filename of the compressed *.ppm file
+	 *  @return true on success, the bitmap has the size of the image in the file
+	*/
+	bool load(const std::string &filename);
+
+	/** function to read the int data stream of Mandelbrot::calculateCompressedImage() (without the *.ppm header)
+	 *
+	 *  @param	pass the data stream
+	 *  @param	specify the number of combined bits of the stream
+	 *  @return true on success (the stream has to contain width * height bits)
+	*/
+	bool read(const std::string &stream, int numOfCombinedBits);
+
+	/** function to save the bitmap as compressed *.ppm file
+	 *
+	 *  @param	specify the filename
+	 *  @param	specify the number of combined bits (reduced with gd(width, numOfCombinedBits) like in the Mandelbrot class)
+	 *  @return ---
+	*/
+	void save(const std::string &filename, int numOfCombinedBits);
+
+	/** functions to combine two bitmaps of the same size word by word; diff (xor) contains the bits which differ
+	 *
+	 *  @param	pass the other bitmap
+	 *  @return the combined bitmap (empty bitmap 0x0, if the sizes don't match)
+	*/
+	PackedBitmap diff(const PackedBitmap &other) const;
+
+	PackedBitmap intersect(const PackedBitmap &other) const;
+
+	PackedBitmap merge(const PackedBitmap &other) const;
+
+	/** function to count the bits which differ between two bitmaps without creating the diff bitmap
+	 *
+	 *  @param	pass the other bitmap
+	 *  @return number of different bits
+	*/
+	uint64_t countDifferences(const PackedBitmap &other) const;
+
+	/** function to count the bits which are set, e.g. the inside area in pixels (multiply with the area of a pixel
+	 * 	to get the area in the complex plane)
+	 *
+	 *  @param	---
+	 *  @return number of set bits
+	*/
+	uint64_t popcount() const;
+
+	/** function to cut out a part of the bitmap
+	 *
+	 *  @param	specify the upper left corner (x|y) and the size of the part
+	 *  @return the part (clipped to the bitmap)
+	*/
+	PackedBitmap crop(unsigned x, unsigned y, unsigned width, unsigned height) const;
+
+	/** function to shrink the bitmap by factor in both directions; a bit is set, if any bit of its factor x factor block
+	 * 	is set (the rows of a block are combined word by word)
+	 *
+	 *  @param	specify the factor
+	 *  @return the downsampled bitmap of (width / factor) x (height / factor)
+	*/
+	PackedBitmap downsample(unsigned factor) const;
+
+	bool get(unsigned x, unsigned y) const;
+
+	void set(unsigned x, unsigned y, bool value);
+
+	unsigned getWidth() const;
+
+	unsigned getHeight() const;
+
+  private:
+	/** function to append numOfBits bits of value (most significant bit first) at the bit position index; the bits are
+	 * 	copied in pieces of whole words (split at the word and row boundaries) */
+	void append(uint64_t &index, uint64_t value, int numOfBits);
+
+	unsigned width, height;
+	size_t wordsPerRow;
+
+	// bit x of a row is bit (x % 64) of word (x / 64), unused bits of the last word of a row are always 0
+	std::vector<uint64_t> words;
+};
+
+#endif /* PACKEDBITMAP_H_ */
@@ -0,0 +1,502 @@
+/*
+ * RegressionCheck.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "Analytics.h"
+#include "JuliaBatch.h"
+#include "Mandelbrot.h"
+#include "PackedBitmap.h"
+#include "PPMImage.h"
+#include "RegressionCheck.h"
+#include "RenderPaths.h"
+#include "TileCache.h"
+#include "TileServer.h"
+#include "ZoomAnimation.h"
+
+// configuration of the golden images
+static const unsigned goldenSize = 600;
+static const int combinedBits[] = { 2, 3, 4, 5, 6, 8, 10, 12, 15, 20, 24, 25, 30 };
+static const unsigned zoomSize = 200;
+
+// the codec functions print their progress, which is not needed here
+class MuteOutput {
+  public:
+	MuteOutput() : buf(std::cout.rdbuf(nullptr)) { }
+	~MuteOutput() { std::cout.rdbuf(buf); }
+  private:
+	std::streambuf *buf;
+};
+
+// number of timed runs of a throughput measurement (after one warm up run), the median is compared with the budget
+static const int timedRuns = 5;
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+	std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+	return time.count();
+}
+
+// runs &run once to warm up caches and the thread pools, then timedRuns times; returns the median of the timed runs,
+// so a single run disturbed by another process does not fail the budget
+static double medianSeconds(const std::function<void()> &run) {
+	std::vector<double> seconds;
+
+	run();
+
+	for (int i = 0; i < timedRuns; i++) {
+		auto start = std::chrono::steady_clock::now();
+		run();
+		seconds.push_back(secondsSince(start));
+	}
+
+	std::sort(seconds.begin(), seconds.end());
+
+	return seconds[timedRuns / 2];
+}
+
+RegressionCheck::RegressionCheck(const std::string &goldenDirectory, const std::string &budgetFile, ThreadPlacement placement) {
+	this->goldenDirectory = goldenDirectory;
+	this->placement = placement;
+
+	std::ifstream in(budgetFile);
+	std::string line = "";
+
+	while (std::getline(in, line)) {
+		if (line == "" || line[0] == '#') {
+			continue;
+		}
+
+		std::stringstream budget(line);
+		std::string name = "";
+		double megaPixelsPerSecond = 0;
+
+		if (budget >> name >> megaPixelsPerSecond) {
+			budgets[name] = megaPixelsPerSecond;
+		}
+	}
+
+	if (budgets.empty()) {
+		std::cout << "warning: No budgets in " << budgetFile << ", throughput will not be checked." << std::endl;
+	}
+}
+
+std::string RegressionCheck::readFile(const std::string &filename) {
+	std::ifstream in(filename, std::ios::binary);
+	std::stringstream content;
+	content << in.rdbuf();
+	return content.str();
+}
+
+void RegressionCheck::report(const std::string &name, bool passed, const std::string &detail) {
+	checks++;
+
+	if (!passed) {
+		failures++;
+	}
+
+	std::cout << (passed ? "[ PASS ] " : "[ FAIL ] ") << name << (detail != "" ? ": " + detail : "") << std::endl;
+}
+
+void RegressionCheck::checkBudget(const std::string &name, double pixels, double seconds) {
+	double megaPixelsPerSecond = pixels / seconds / 1e6;
+
+	std::stringstream detail;
+	detail << megaPixelsPerSecond << " Mpixel/s";
+
+	auto budget = budgets.find(name);
+
+	if (budget == budgets.end()) {
+		std::cout << "[ INFO ] throughput " << name << ": " << detail.str() << " (no budget)" << std::endl;
+		return;
+	}
+
+	detail << " (budget " << budget->second << ")";
+
+#ifndef __OPTIMIZE__
+	// the budgets are measured with optimized builds (-O2), a debug build is not comparable
+	std::cout << "[ INFO ] throughput " << name << ": " << detail.str() << ", not checked (no optimized build)" << std::endl;
+	return;
+#endif
+
+	report("throughput " + name, megaPixelsPerSecond >= budget->second, detail.str());
+}
+
+void RegressionCheck::checkCompressed(bool cached) {
+	TileCache *cache = TileCache::getInstance();
+	bool wasEnabled = cache->isEnabled();
+
+	cache->clear();
+	cache->setEnabled(cached);
+
+	std::string path = cached ? "compressed-cached" : "compressed";
+	std::string coded = (std::filesystem::temp_directory_path() / "mandelbrot-verify-coded.ppm").string();
+
+	// row method with 4 threads, the same function as the default mode of main()
+	auto render = [this, &coded](int bits) {
+		MuteOutput mute;
+		createMandelbrotImageCompressed(coded, goldenSize, goldenSize, 4, bits, placement);
+	};
+
+	for (int bits : combinedBits) {
+		std::string golden = goldenDirectory + "/coded/combined-bits/mandelbrot-coded-" + std::to_string(bits) + ".ppm";
+
+		render(bits);
+		report(path + " " + std::to_string(bits) + " bits", readFile(coded) == readFile(golden), golden);
+	}
+
+	// every run starts with an empty cache -> the first compression level is computed, the others are taken from the cache
+	double seconds = medianSeconds([&]() {
+		cache->clear();
+
+		for (int bits : combinedBits) {
+			render(bits);
+		}
+	});
+
+	checkBudget(path, (double) std::size(combinedBits) * goldenSize * goldenSize, seconds);
+
+	cache->setEnabled(wasEnabled);
+	std::remove(coded.c_str());
+}
+
+void RegressionCheck::checkImage() {
+	std::filesystem::path tmp = std::filesystem::temp_directory_path();
+	std::string coded = (tmp / "mandelbrot-verify-coded.ppm").string();
+	std::string decoded = (tmp / "mandelbrot-verify-decoded.ppm").string();
+	std::string golden = goldenDirectory + "/decoded/mandelbrot-decoded-1.ppm";
+
+	// every thread allocates the rows it writes (first touch), as in the render mode of main()
+	PPMImage image(goldenSize, goldenSize, true);
+
+	auto codec = [&coded, &decoded](PPMImage &image) {
+		MuteOutput mute;
+		PPMImage result(goldenSize, goldenSize);
+
+		image.codeImg(coded);
+		result.decodeImg(coded, decoded);
+	};
+
+	// chess board method with 16 threads (not pinned)
+	auto render = [&image]() {
+		TileCache::getInstance()->clear();
+
+		MuteOutput mute;
+		createMandelbrotImage(image, goldenSize, goldenSize, 16, 34);
+	};
+
+	render();
+	codec(image);
+	report("calculateImage (chess board) + codeImg + decodeImg", readFile(decoded) == readFile(golden), golden);
+
+	checkBudget("image", goldenSize * goldenSize, medianSeconds(render));
+	checkBudget("codec", goldenSize * goldenSize, medianSeconds([&]() { codec(image); }));
+
+	// pinned threads -> row bands; without --placement the threads are placed compact
+	ThreadPlacement pinned = (placement.getPolicy() != ThreadPlacement::NONE) ? placement : ThreadPlacement(ThreadPlacement::COMPACT);
+	PPMImage banded(goldenSize, goldenSize, true);
+
+	TileCache::getInstance()->clear();
+
+	{
+		MuteOutput mute;
+		createMandelbrotImage(banded, goldenSize, goldenSize, 16, 34, pinned);
+	}
+
+	codec(banded);
+	report("calculateImage (row bands, pinned threads) + codeImg + decodeImg", readFile(decoded) == readFile(golden), golden);
+
+	std::remove(coded.c_str());
+	std::remove(decoded.c_str());
+}
+
+void RegressionCheck::checkDecode() {
+	std::string decoded = (std::filesystem::temp_directory_path() / "mandelbrot-verify-decoded.ppm").string();
+	std::string coded = goldenDirectory + "/coded/combined-bits/mandelbrot-coded-30.ppm";
+	std::string golden = goldenDirectory + "/decoded/mandelbrot-decoded-2.ppm";
+
+	{
+		MuteOutput mute;
+		PPMImage result(goldenSize, goldenSize);
+		result.decodeImg(coded, decoded);
+	}
+
+	report("decodeImg", readFile(decoded) == readFile(golden), golden);
+
+	std::remove(decoded.c_str());
+}
+
+void RegressionCheck::checkPackedBitmap() {
+	PackedBitmap reference(0, 0);
+
+	if (!reference.load(goldenDirectory + "/coded/combined-bits/mandelbrot-coded-30.ppm")) {
+		report("PackedBitmap", false, "unable to load the golden image");
+		return;
+	}
+
+	for (int bits : combinedBits) {
+		PackedBitmap bitmap(0, 0);
+		bool loaded = bitmap.load(goldenDirectory + "/coded/combined-bits/mandelbrot-coded-" + std::to_string(bits) + ".ppm");
+
+		report("PackedBitmap " + std::to_string(bits) + " bits", loaded && bitmap.countDifferences(reference) == 0, "");
+	}
+
+	// a fresh render read from the compressed stream has to be the same image
+	std::string buf = "";
+	Mandelbrot mandelbrot(goldenSize, goldenSize, 0, goldenSize, 0, goldenSize);
+	mandelbrot.setCompressionLevel(24);
+	mandelbrot.calculateCompressedImage(buf);
+
+	PackedBitmap rendered(goldenSize, goldenSize);
+	bool complete = rendered.read(buf, 24);
+
+	report("PackedBitmap read", complete && rendered.countDifferences(reference) == 0, "");
+
+	uint64_t differences = 0;
+
+	double seconds = medianSeconds([&]() {
+		for (int i = 0; i < 200; i++) {
+			differences += rendered.countDifferences(reference);
+		}
+	});
+
+	checkBudget("packed-compare", 200.0 * goldenSize * goldenSize, seconds);
+
+	if (differences != 0) {
+		report("PackedBitmap compare", false, std::to_string(differences) + " differences");
+	}
+}
+
+void RegressionCheck::checkAnalytics() {
+	PackedBitmap reference(0, 0);
+	reference.load(goldenDirectory + "/coded/combined-bits/mandelbrot-coded-30.ppm");
+
+	Analytics analytics(goldenSize, goldenSize, 4, 34);
+
+	Statistics statistics;
+
+	double seconds = medianSeconds([&]() {
+		statistics = analytics.scanGrid();
+	});
+
+	checkBudget("analytics", goldenSize * goldenSize, seconds);
+
+	report("Analytics grid", statistics.inside == reference.popcount(),
+			std::to_string(statistics.inside) + " inside, golden " + std::to_string(reference.popcount()));
+}
+
+void RegressionCheck::checkPanned() {
+	TileCache *cache = TileCache::getInstance();
+	bool wasEnabled = cache->isEnabled();
+
+	const double scale = 2.4 / (goldenSize - 1);
+	const unsigned pan = 40;
+
+	Mandelbrot first(goldenSize, goldenSize, 0, goldenSize, 0, goldenSize);
+	Mandelbrot panned(goldenSize, goldenSize, 0, goldenSize, 0, goldenSize);
+	first.setViewport(-0.65, 0, scale);
+	panned.setViewport(-0.65 + pan * scale, 0.5 * pan * scale, scale);
+
+	std::vector<unsigned char> inside, reference;
+
+	cache->setEnabled(false);
+	panned.calculateRegion(reference);
+
+	cache->clear();
+	cache->setEnabled(true);
+	first.calculateRegion(inside);
+
+	size_t hits = cache->getHits(), misses = cache->getMisses();
+	panned.calculateRegion(inside);
+	hits = cache->getHits() - hits;
+	misses = cache->getMisses() - misses;
+
+	cache->setEnabled(wasEnabled);
+
+	// the panned render shares all tiles but the new columns and rows with the first render
+	report("panned render", hits > misses && inside == reference, std::to_string(hits) + " tiles from the cache, "
+			+ std::to_string(misses) + " computed");
+}
+
+void RegressionCheck::checkStream() {
+	PackedBitmap reference(0, 0);
+	reference.load(goldenDirectory + "/coded/combined-bits/mandelbrot-coded-30.ppm");
+
+	// tiles which do not divide the image -> clipped tiles at the right and bottom border
+	Mandelbrot mandelbrot(goldenSize, goldenSize, 0, goldenSize, 0, goldenSize);
+	PackedBitmap rendered(goldenSize, goldenSize);
+	uint64_t pixels = 0;
+
+	auto render = [&]() {
+		TileCache::getInstance()->clear();
+
+		TileStream stream = mandelbrot.streamTiles(64, 48, 4);
+		pixels = 0;
+
+		while (stream.next()) {
+			Tile &tile = stream.get();
+			unsigned tileWidth = tile.maxX - tile.minX;
+
+			for (unsigned y = tile.minY; y < tile.maxY; ++y) {
+				for (unsigned x = tile.minX; x < tile.maxX; ++x) {
+					rendered.set(x, y, tile.inside[(y - tile.minY) * tileWidth + (x - tile.minX)]);
+				}
+			}
+
+			pixels += tile.inside.size();
+		}
+	};
+
+	checkBudget("stream", goldenSize * goldenSize, medianSeconds(render));
+
+	report("TileStream", pixels == goldenSize * goldenSize && rendered.countDifferences(reference) == 0,
+			std::to_string(pixels) + " pixels streamed");
+
+	// compressed file written strip by strip, as in the stream mode of main()
+	std::string coded = (std::filesystem::temp_directory_path() / "mandelbrot-verify-stream.ppm").string();
+	std::string golden = goldenDirectory + "/coded/combined-bits/mandelbrot-coded-30.ppm";
+
+	{
+		MuteOutput mute;
+		createMandelbrotImageStreamed(coded, goldenSize, goldenSize, 4, 30);
+	}
+
+	report("createMandelbrotImageStreamed", readFile(coded) == readFile(golden), golden);
+
+	std::remove(coded.c_str());
+}
+
+void RegressionCheck::checkZoom() {
+	std::string saved = (std::filesystem::temp_directory_path() / "mandelbrot-verify-zoom.ppm").string();
+	std::string golden = goldenDirectory + "/zoom/mandelbrot-zoom-1.ppm";
+
+	// the second frame halves the scale -> every other pixel in both directions is copied from the first frame
+	ZoomAnimation animation(zoomSize, zoomSize, 4, 200);
+	Keyframe first = { -0.743643887037151, 0.131825904205330, 2.4 / zoomSize, 0 };
+	Keyframe second = { -0.743643887037151, 0.131825904205330, 2.4 / zoomSize / 2, 0 };
+
+	PPMImage previousImage(zoomSize, zoomSize), image(zoomSize, zoomSize);
+	animation.calculateFrame(first, previousImage, nullptr, nullptr);
+	size_t reused = animation.calculateFrame(second, image, &first, &previousImage);
+
+	{
+		MuteOutput mute;
+		image.save(saved);
+	}
+
+	report("ZoomAnimation reused frame", reused > 0 && readFile(saved) == readFile(golden),
+			golden + ", " + std::to_string(reused) + " pixels reused");
+
+	std::remove(saved.c_str());
+}
+
+void RegressionCheck::checkTile() {
+	std::string golden = goldenDirectory + "/tiles/tile-2-1-1.bmp";
+
+	TileServer server(0, 1, 200);
+	TileCache *cache = TileCache::getInstance();
+
+	// the server bypasses the TileCache -> no lookups
+	size_t lookups = cache->getHits() + cache->getMisses();
+	bool matches = server.renderTile(2, 1, 1) == readFile(golden);
+
+	report("TileServer tile", matches && cache->getHits() + cache->getMisses() == lookups, golden);
+}
+
+void RegressionCheck::checkJulia() {
+	const unsigned size = 64;
+	const int iterations = 100;
+
+	// grid of the default viewport plus parameters with |c| > 2; 67 parameters -> the last group of lanes is incomplete
+	JuliaBatch batch(size, 4, iterations);
+	batch.addParameterGrid(8, 8);
+	batch.addParameter(-2.5, 0);
+	batch.addParameter(0, 2.1);
+	batch.addParameter(0.285, 0.01);
+
+	std::vector<double> parametersRe, parametersIm;
+	Mandelbrot grid(8, 8);
+
+	for (unsigned y = 0; y < 8; ++y) {
+		for (unsigned x = 0; x < 8; ++x) {
+			parametersRe.push_back(grid.getRe(x));
+			parametersIm.push_back(grid.getIm(y));
+		}
+	}
+
+	parametersRe.insert(parametersRe.end(), { -2.5, 0, 0.285 });
+	parametersIm.insert(parametersIm.end(), { 0, 2.1, 0.01 });
+
+	std::vector<unsigned int> escapeTimes;
+
+	double seconds = medianSeconds([&]() {
+		batch.calculate(escapeTimes);
+	});
+
+	checkBudget("julia", (double) escapeTimes.size(), seconds);
+
+	// scalar reference, one pixel after the other with an early exit
+	double scale = 4.0 / size;
+	uint64_t differences = 0;
+
+	for (size_t t = 0; t < parametersRe.size(); ++t) {
+		for (unsigned y = 0; y < size; ++y) {
+			for (unsigned x = 0; x < size; ++x) {
+				double Z_re = -scale * (size / 2) + x * scale, Z_im = scale * (size / 2) - y * scale;
+				unsigned int n = 0;
+
+				for (; n < (unsigned int) iterations; ++n) {
+					double Z_re2 = Z_re * Z_re, Z_im2 = Z_im * Z_im;
+
+					if (Z_re2 + Z_im2 > 4) {
+						break;
+					}
+
+					Z_im = 2 * Z_re * Z_im + parametersIm[t];
+					Z_re = Z_re2 - Z_im2 + parametersRe[t];
+				}
+
+				if (t * size * size + y * size + x >= escapeTimes.size() || escapeTimes[t * size * size + y * size + x] != n) {
+					differences++;
+				}
+			}
+		}
+	}
+
+	report("JuliaBatch", differences == 0, std::to_string(parametersRe.size()) + " thumbnails, "
+			+ std::to_string(differences) + " different pixels");
+}
+
+bool RegressionCheck::run() {
+	std::cout << "Checking render paths against the golden images in " << goldenDirectory << " ...\n" << std::endl;
+
+	checks = 0;
+	failures = 0;
+
+	checkCompressed(false);
+	checkCompressed(true);
+	checkImage();
+	checkDecode();
+	checkPackedBitmap();
+	checkAnalytics();
+	checkPanned();
+	checkStream();
+	checkZoom();
+	checkTile();
+	checkJulia();
+
+	std::cout << std::endl << (checks - failures) << " of " << checks << " checks passed.\n" << std::endl;
+
+	return failures == 0;
+}
@@ -0,0 +1,95 @@
+/*
+ * RegressionCheck.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ *  src:
+ *
+ *  [1]	https://en.wikipedia.org/wiki/Characterization_test
+ *  [2] https://en.cppreference.com/w/cpp/chrono/steady_clock
+ */
+
+#ifndef REGRESSIONCHECK_H_
+#define REGRESSIONCHECK_H_
+
+#include <iostream>
+#include <map>
+#include <string>
+
+#include "ThreadPlacement.h"
+
+class RegressionCheck {
+  public:
+	/** constructor; the golden images are the checked in files of the pic directory:
+	 *
+	 * 		pic/coded/combined-bits/mandelbrot-coded-<bits>.ppm	compressed row method, 600x600, 4 threads, 34 iterations
+	 * 		pic/decoded/mandelbrot-decoded-1.ppm				chess board method + codeImg() + decodeImg()
+	 * 		pic/decoded/mandelbrot-decoded-2.ppm				decodeImg() of the compressed image with 30 bits
+	 * 		pic/zoom/mandelbrot-zoom-1.ppm						second frame of a zoom (200x200, 200 iterations, scale halved),
+	 * 															calculated without the previous frame
+	 * 		pic/tiles/tile-2-1-1.bmp							TileServer tile z = 2, x = 1, y = 1 (200 iterations),
+	 * 															rendered without the TileCache
+	 *
+	 * 	the budget file contains lines "<render path> <minimum mega pixels per second>", lines starting with # are ignored.
+	 *
+	 *  @param	specify the directory of the golden images
+	 *  @param	specify the budget file
+	 *  @param	specify the placement of the render threads (default: not pinned)
+	 *  @return ---
+	*/
+	RegressionCheck(const std::string &goldenDirectory, const std::string &budgetFile, ThreadPlacement placement = ThreadPlacement());
+
+	/** function to render the golden configurations through every render path, compare the results bit for bit with the
+	 * 	golden images and the throughput with the budgets
+	 *
+	 *  @param	---
+	 *  @return true if every check passed
+	*/
+	bool run();
+
+  private:
+	// createMandelbrotImageCompressed(), cold (TileCache disabled) and cached
+	void checkCompressed(bool cached);
+
+	// createMandelbrotImage() (chess board and pinned row bands) -> codeImg() -> decodeImg()
+	void checkImage();
+
+	// decodeImg() of a golden compressed image
+	void checkDecode();
+
+	// PackedBitmap: all compression levels contain the same image
+	void checkPackedBitmap();
+
+	// Analytics: inside count of the grid == set bits of the golden image
+	void checkAnalytics();
+
+	// TileCache: a render panned by whole pixels reuses the tiles of the previous render
+	void checkPanned();
+
+	// Mandelbrot::streamTiles() and createMandelbrotImageStreamed(): all tiles of the stream == golden image
+	void checkStream();
+
+	// ZoomAnimation::calculateFrame() with the pixels of the previous frame == frame calculated without it
+	void checkZoom();
+
+	// TileServer::renderTile() == golden tile
+	void checkTile();
+
+	// JuliaBatch: vectorized lanes == scalar iteration
+	void checkJulia();
+
+	void checkBudget(const std::string &name, double pixels, double seconds);
+
+	void report(const std::string &name, bool passed, const std::string &detail);
+
+	std::string readFile(const std::string &filename);
+
+	std::string goldenDirectory;
+	ThreadPlacement placement;
+	std::map<std::string, double> budgets;
+
+	int checks = 0;
+	int failures = 0;
+};
+
+#endif /* REGRESSIONCHECK_H_ */
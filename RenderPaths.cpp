@@ -0,0 +1,295 @@
+/*
+ * RenderPaths.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <fstream>
+#include <thread>
+#include <vector>
+#include <math.h>
+
+#include "RenderPaths.h"
+
+static void createMandelbrotImageThread(Mandelbrot * mandelbrot, PPMImage &image, ThreadPlacement * placement, int worker, unsigned minY, unsigned maxY) {
+	// pin the thread before touching the rows -> the rows are allocated on the NUMA node of this thread
+	placement->pinCurrentThread(worker);
+	image.allocateRows(minY, maxY);
+
+	mandelbrot->calculateImage(image);
+}
+
+void createMandelbrotImage(PPMImage &image, unsigned int width, unsigned int height, int numOfThreads, int iterations,
+		ThreadPlacement placement) {
+
+	/*
+	 * 	sub image coordinate computation (e.g. 600x600, 4 threads) -> chess board method
+	 *
+	 *	-- x
+	 *	|
+	 *	y
+	 *
+	 *	P0a(0|0)		P2a(300|0)
+	 *		x_______________x_______________
+	 * 		|				|				|
+	 * 		|				|				|
+	 * 		|		0		|		2		|
+	 * 		|				|				|
+	 * 		|_______________|_______________|
+	 *						x				x
+	 * 				   P0e(300|300)	   P2e(600|300)
+	 *
+	 * 					  ------
+	 *
+	 * 	P1a(0|300)	 P3a(300|300)
+	 * 		x_______________x_______________
+	 * 		|				|				|
+	 * 		|				|				|
+	 * 		|		1		|		3		|
+	 * 		|				|				|
+	 * 		|_______________|_______________|
+	 *						x				x
+	 * 				   P1e(300|600)	   P3e(600|600)
+	 *
+	 */
+
+	std::cout << "Creating image ...\n";
+
+	if (placement.getPolicy() != ThreadPlacement::NONE) {
+		/*
+		 * 	pinned threads -> row bands instead of the chess board: in the chess board every row is written by
+		 * 	devider threads, which sit on different NUMA nodes (e.g. "scatter"); with row bands every thread only
+		 * 	writes the rows it allocated itself (first touch)
+		 */
+		std::cout << "sub images are arranged as " << numOfThreads << " row bands (pinned threads)." << std::endl;
+
+		std::vector<std::thread> workers;
+		std::vector<Mandelbrot *> partMandelbrot(numOfThreads);
+
+		for (int i = 0; i < numOfThreads; i++) {
+			unsigned minY = i * height / numOfThreads, maxY = (i + 1) * height / numOfThreads;
+
+			partMandelbrot[i] = new Mandelbrot(width, height, 0, width, minY, maxY, iterations);
+
+			workers.push_back(std::thread(createMandelbrotImageThread, partMandelbrot[i], std::ref(image), &placement, i, minY, maxY));
+
+			std::cout << "Thread #" << i << " created. Calculating (0," << minY << ") to (" << width << "," << maxY << "), "
+					  << placement.describe(i) << ".\n";
+		}
+
+		for (auto &th : workers) {
+			th.join();
+		}
+
+		for (auto mandelbrot : partMandelbrot) {
+			delete mandelbrot;
+		}
+
+		std::cout << "Finished.\n" << std::endl;
+		return;
+	}
+
+	// is the image divisible into numOfThreads sub pictures (chess board)
+	if ( HelperFunctions::getInstance()->isPerfectSquare(numOfThreads) == true ) {
+		int devider = sqrt(numOfThreads);
+
+		std::cout << "sub images are arranged as a chess board with " << devider << "x" << devider <<" fields." << std::endl;
+
+		// depending on the width/height, is the image still divisible into even numOfThreads sub pictures?
+		if ( width % devider == 0 ) {
+			unsigned minX, minY, maxX, maxY;
+
+			std::vector<std::thread> workers;
+
+			Mandelbrot *partMandelbrot[numOfThreads];
+
+			for (int i = 0; i < numOfThreads; i++) {
+				// coordinates calculation
+				minX = (i / devider) * (width / devider);
+				maxX = ((i / devider) + 1) * (width / devider);
+				minY = (i % devider) * (height / devider);
+				maxY = ((i % devider) + 1) * (height / devider);
+
+				// the chess board is only used for threads which are not pinned (see above)
+				int worker = i;
+
+				partMandelbrot[i] = new Mandelbrot(width, height, minX, maxX, minY, maxY, iterations);
+
+				workers.push_back(std::thread(createMandelbrotImageThread, partMandelbrot[i], std::ref(image), &placement, worker, minY, maxY));
+
+				std::cout << "Thread #" << i << " created. Calculating (" << minX << "," << minY << ") to (" << maxX << "," << maxY << "), "
+						  << placement.describe(worker) << ".\n";
+			}
+
+			for (auto &th : workers)
+			{
+				th.join();
+			}
+
+			for (int i = 0; i < numOfThreads; i++) {
+				delete partMandelbrot[i];
+			}
+
+			std::cout << "Finished.\n" << std::endl;;
+		} else {
+			std::cout << "error: Image width/height not divisible with given amount of threads! "
+				  << width << " / " << "sqrt(" << numOfThreads << ") = "
+				  << width / sqrt(numOfThreads) << "\n" << std::endl;
+
+			std::cout << "Canceled.\n";
+			image.allocateRows(0, height);
+		}
+	} else {
+		std::cout << "error: Number of threads doesn't match! Has to be an even number of sqrt(" << numOfThreads << ") = "
+			  << sqrt(numOfThreads) <<".\n" << std::endl;
+
+		std::cout << "Canceled.\n";
+		image.allocateRows(0, height);
+	}
+}
+
+static void createMandelbrotImageCompressedThread(Mandelbrot * mandelbrot, std::string &returnBuf, ThreadPlacement * placement, int worker) {
+	placement->pinCurrentThread(worker);
+
+	mandelbrot->calculateCompressedImage(returnBuf);
+}
+
+void createMandelbrotImageCompressed(std::string filename, unsigned int width, unsigned int height, int numOfThreads, int numOfCombinedBits,
+		ThreadPlacement placement) {
+
+	/*
+	 * 	sub image coordinate computation (e.g. 600x600, 5 threads) -> row method
+	 *
+	 *	-- x
+	 *	|
+	 *	y
+	 *
+	 *	P0a(0|0)
+	 *		x________________________________
+	 * 		|								|
+	 * 		|				0				|
+	 * 		|_______________________________|
+	 *										x
+	 *	P1a(0|150)						P0a(600|150)
+	 *		x________________________________
+	 * 		|								|
+	 * 		|				1				|
+	 * 		|_______________________________|
+	 *										x
+	 *	P2a(0|300)						P1e(600|300)
+	 *		x________________________________
+	 * 		|								|
+	 * 		|				2				|
+	 * 		|_______________________________|
+	 * 										x
+	 * 						.			P2e(600|450)
+	 * 						.
+	 * 						.
+	 *		_________________________________
+	 * 		|								|
+	 * 		|				3				|
+	 * 		|_______________________________|
+	 *		_________________________________
+	 * 		|								|
+	 * 		|				4				|
+	 * 		|_______________________________|
+	 *
+	 */
+
+	std::cout << "Creating compressed image...\n";
+
+	// buffer for the results of the threads
+	std::string * buf = new std::string[numOfThreads];
+
+	// is the image divisible into numOfThreads sub pictures (rows)
+	if ( width % numOfThreads == 0 ) {
+		int devider = numOfThreads;
+		unsigned minX, minY, maxX, maxY;
+
+		std::cout << "sub images are arranged as " << devider << "x" << " rows." << std::endl;
+
+		// combine maximal compressionLevel bits of the bitstream to a new number
+		// e.g. 0110 0010 ... -> 10 2 ...
+		int numCombinedBits = HelperFunctions::getInstance()->gd(width, numOfCombinedBits);
+
+		std::cout << "compression level (bits combined): " << numCombinedBits << std::endl;
+
+		std::vector<std::thread> workers;
+
+		Mandelbrot *partMandelbrot[numOfThreads];
+
+		for (int i = 0; i < numOfThreads; i++) {
+			minX = 0;
+			maxX = width;
+			minY = i * (height / numOfThreads);
+			maxY = (i+1) * (height / numOfThreads);
+
+			partMandelbrot[i] = new Mandelbrot(width, height, minX, maxX, minY, maxY);
+			partMandelbrot[i]->setCompressionLevel(numCombinedBits);
+
+			workers.push_back(std::thread(createMandelbrotImageCompressedThread, partMandelbrot[i], std::ref(buf[i]), &placement, i));
+
+			std::cout << "Thread #" << i << " created. Calculating (" << minX << "," << minY << ") to (" << maxX << "," << maxY << "), "
+					  << placement.describe(i) << ".\n";
+		}
+
+		for (auto &th : workers) {
+			th.join();
+		}
+
+		for (int i = 0; i < numOfThreads; i++) {
+			delete partMandelbrot[i];
+		}
+
+		std::cout << "Compressed from " << width*height << " to " << ((width * height) / numCombinedBits) << " characters -> done." << std::endl;
+		std::cout << "tile cache: " << TileCache::getInstance()->getHits() << " hits, "
+				  << TileCache::getInstance()->getMisses() << " misses (total).\n" << std::endl;
+
+		// collect results and create PPM file to store the compressed image
+
+		Mandelbrot mandelbrot(width, height);
+
+		mandelbrot.createPPMFile(filename);
+
+		for(int i=0; i < numOfThreads; i++) {
+			mandelbrot.writeToPPMFile(filename, buf[i]);
+		}
+
+		std::cout << "Finished.\n" << std::endl;;
+	} else {
+		std::cout << "error: Number of threads doesn't match! Has to be an even number of " << height << " / "
+			  << numOfThreads << " = "
+			  << (float)height / numOfThreads <<".\n" << std::endl;
+
+		std::cout << "Canceled.\n";
+	}
+
+	delete[] buf;
+}
+
+void createMandelbrotImageStreamed(std::string filename, unsigned int width, unsigned int height, int numOfThreads, int numOfCombinedBits) {
+	/*
+	 * 	the image is pulled as a stream of strips (full rows) and every strip is compressed and written as soon as it
+	 * 	arrives -> only numOfThreads strips exist at the same time, independent of the image size
+	 */
+	std::cout << "Creating streamed compressed image...\n";
+
+	int numCombinedBits = HelperFunctions::getInstance()->gd(width, numOfCombinedBits);
+	std::cout << "compression level (bits combined): " << numCombinedBits << std::endl;
+
+	Mandelbrot mandelbrot(width, height, 0, width, 0, height);
+	mandelbrot.createPPMFile(filename);
+
+	std::ofstream out(filename, std::ios::app);
+	TileStream stream = mandelbrot.streamTiles(width, 16, numOfThreads);
+
+	while (stream.next()) {
+		// the strips contain full rows, width % numCombinedBits == 0 -> the combined values do not cross the strips
+		std::string buf = "";
+		HelperFunctions::getInstance()->combineBits(stream.get().inside, numCombinedBits, buf);
+
+		out << buf;
+	}
+
+	std::cout << "Finished.\n" << std::endl;
+}
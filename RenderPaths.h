@@ -0,0 +1,57 @@
+/*
+ * RenderPaths.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ *  src:
+ *
+ *  [1]	https://www.kernel.org/doc/html/latest/admin-guide/mm/numa_memory_policy.html (first touch)
+ */
+
+#ifndef RENDERPATHS_H_
+#define RENDERPATHS_H_
+
+#include <iostream>
+#include <string>
+
+#include "Mandelbrot.h"
+#include "PPMImage.h"
+#include "ThreadPlacement.h"
+
+/** function to render the mandelbrot fractal with numOfThreads threads into image. Without placement the image is split
+ * 	into a chess board (numOfThreads has to be a square number, sqrt(numOfThreads) has to divide the width); with pinned
+ * 	threads it is split into row bands, so every thread only writes the rows it allocated itself (first touch, see
+ * 	PPMImage(height, width, true)).
+ *
+ *  @param	pass the reference to the image (height x width)
+ *  @param	specify the width and height of the image
+ *  @param	specify the number of threads and iterations
+ *  @param	specify the placement of the threads (default: not pinned)
+ *  @return &image will contain the fractal
+*/
+void createMandelbrotImage(PPMImage &image, unsigned int width, unsigned int height, int numOfThreads, int iterations,
+		ThreadPlacement placement = ThreadPlacement());
+
+/** function to render the mandelbrot fractal with numOfThreads threads (row method) and to write it as compressed *.ppm
+ * 	file; numOfThreads has to divide the width.
+ *
+ *  @param	specify the filename of the compressed image
+ *  @param	specify the width and height of the image
+ *  @param	specify the number of threads and the maximum number of combined bits (see HelperFunctions::gd())
+ *  @param	specify the placement of the threads (default: not pinned)
+ *  @return ---
+*/
+void createMandelbrotImageCompressed(std::string filename, unsigned int width, unsigned int height, int numOfThreads, int numOfCombinedBits,
+		ThreadPlacement placement = ThreadPlacement());
+
+/** function to render the mandelbrot fractal as a stream of strips (Mandelbrot::streamTiles()) and to write it as compressed
+ * 	*.ppm file; every strip is written as soon as it arrives, at most numOfThreads strips exist at the same time.
+ *
+ *  @param	specify the filename of the compressed image
+ *  @param	specify the width and height of the image
+ *  @param	specify the number of threads and the maximum number of combined bits (see HelperFunctions::gd())
+ *  @return ---
+*/
+void createMandelbrotImageStreamed(std::string filename, unsigned int width, unsigned int height, int numOfThreads, int numOfCombinedBits);
+
+#endif /* RENDERPATHS_H_ */
@@ -0,0 +1,250 @@
+/*
+ * ThreadPlacement.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <pthread.h>
+#include <sched.h>
+#include <sstream>
+#include <thread>
+
+#include "ThreadPlacement.h"
+
+// parses a core number; false if the text is no number or does not fit into an int (no exception like std::stoi)
+static bool parseCore(const std::string &text, int &core) {
+	char *end = nullptr;
+	errno = 0;
+	long value = strtol(text.c_str(), &end, 10);
+
+	if (text == "" || *end != '\0' || errno == ERANGE || value < 0 || value > INT_MAX) {
+		return false;
+	}
+
+	core = (int) value;
+	return true;
+}
+
+ThreadPlacement::ThreadPlacement() {
+	policy = NONE;
+}
+
+ThreadPlacement::ThreadPlacement(Policy policy) {
+	this->policy = policy;
+
+	if (policy == NONE || policy == LIST) {
+		this->policy = NONE;
+		return;
+	}
+
+	readTopology();
+
+	if (policy == COMPACT) {
+		for (auto &node : nodes) {
+			cores.insert(cores.end(), node.begin(), node.end());
+		}
+	} else {
+		// SCATTER: first core of every node, then the second core of every node, ...
+		size_t maxCoresPerNode = 0;
+
+		for (auto &node : nodes) {
+			maxCoresPerNode = std::max(maxCoresPerNode, node.size());
+		}
+
+		for (size_t i = 0; i < maxCoresPerNode; i++) {
+			for (auto &node : nodes) {
+				if (i < node.size()) {
+					cores.push_back(node[i]);
+				}
+			}
+		}
+	}
+
+	if (cores.empty()) {
+		this->policy = NONE;
+	}
+}
+
+ThreadPlacement::ThreadPlacement(const std::vector<int> &cores) {
+	policy = cores.empty() ? NONE : LIST;
+	this->cores = cores;
+
+	readTopology();
+}
+
+ThreadPlacement ThreadPlacement::parse(const std::string &description) {
+	if (description == "compact") {
+		return ThreadPlacement(COMPACT);
+	} else if (description == "scatter") {
+		return ThreadPlacement(SCATTER);
+	} else if (description != "" && description.find_first_not_of("0123456789,") == std::string::npos) {
+		std::vector<int> cores;
+		std::stringstream in(description);
+		std::string core = "";
+		bool valid = true;
+
+		while (std::getline(in, core, ',')) {
+			int value = 0;
+
+			if (core == "") {
+				continue;
+			}
+
+			if (!parseCore(core, value)) {
+				valid = false;
+				break;
+			}
+
+			cores.push_back(value);
+		}
+
+		if (valid) {
+			return ThreadPlacement(cores);
+		}
+	}
+
+	if (description != "" && description != "none") {
+		std::cout << "error: Unknown thread placement \"" << description << "\", threads will not be pinned." << std::endl;
+	}
+
+	return ThreadPlacement();
+}
+
+// parses a list of the sysfs format, e.g. "0-3,8-11" -> 0, 1, 2, 3, 8, 9, 10, 11; invalid ranges are skipped
+static std::vector<int> parseList(const std::string &line) {
+	std::vector<int> values;
+	std::stringstream ranges(line);
+	std::string range = "";
+
+	while (std::getline(ranges, range, ',')) {
+		if (range == "") {
+			continue;
+		}
+
+		size_t dash = range.find('-');
+		int first = 0, last = 0;
+
+		if (!parseCore(range.substr(0, dash), first)) {
+			continue;
+		}
+
+		if (dash == std::string::npos) {
+			last = first;
+		} else if (!parseCore(range.substr(dash + 1), last)) {
+			continue;
+		}
+
+		for (int value = first; value <= last; value++) {
+			values.push_back(value);
+		}
+	}
+
+	return values;
+}
+
+void ThreadPlacement::readTopology() {
+	// cores this process is allowed to run on
+	cpu_set_t allowed;
+	CPU_ZERO(&allowed);
+	bool hasAffinity = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+	auto isAllowed = [&](int core) { return !hasAffinity || (core < CPU_SETSIZE && CPU_ISSET(core, &allowed)); };
+
+	// the node ids might be sparse (e.g. "0,2" after a node went offline), so they are listed instead of counted
+	std::ifstream online("/sys/devices/system/node/online");
+	std::string line = "";
+	std::getline(online, line);
+
+	for (int node : parseList(line)) {
+		std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+
+		if (!in.is_open()) {
+			continue;
+		}
+
+		std::string cpulist = "";
+		std::getline(in, cpulist);
+		std::vector<int> nodeCores;
+
+		for (int core : parseList(cpulist)) {
+			if (isAllowed(core)) {
+				nodeCores.push_back(core);
+			}
+		}
+
+		nodes.push_back(nodeCores);
+		nodeIds.push_back(node);
+	}
+
+	if (nodes.empty()) {
+		// no NUMA information (e.g. not a linux system) -> one node with all cores
+		std::vector<int> nodeCores;
+
+		for (int core = 0; core < (int) std::thread::hardware_concurrency(); core++) {
+			if (isAllowed(core)) {
+				nodeCores.push_back(core);
+			}
+		}
+
+		nodes.push_back(nodeCores);
+		nodeIds.push_back(0);
+	}
+}
+
+int ThreadPlacement::getCore(int workerIndex) {
+	if (policy == NONE || cores.empty()) {
+		return -1;
+	}
+
+	return cores[workerIndex % cores.size()];
+}
+
+int ThreadPlacement::getNode(int core) {
+	for (size_t node = 0; node < nodes.size(); node++) {
+		for (int c : nodes[node]) {
+			if (c == core) {
+				return nodeIds[node];
+			}
+		}
+	}
+
+	return -1;
+}
+
+bool ThreadPlacement::pinCurrentThread(int workerIndex) {
+	int core = getCore(workerIndex);
+
+	if (core < 0) {
+		return policy == NONE;
+	}
+
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(core, &set);
+
+	if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+		std::cout << "error: Unable to pin worker #" << workerIndex << " to core " << core << ".\n";
+		return false;
+	}
+
+	return true;
+}
+
+std::string ThreadPlacement::describe(int workerIndex) {
+	int core = getCore(workerIndex);
+
+	if (core < 0) {
+		return "not pinned";
+	}
+
+	return "core " + std::to_string(core) + " (node " + std::to_string(getNode(core)) + ")";
+}
+
+ThreadPlacement::Policy ThreadPlacement::getPolicy() {
+	return policy;
+}
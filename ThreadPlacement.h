@@ -0,0 +1,103 @@
+/*
+ * ThreadPlacement.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ *  src:
+ *
+ *  [1]	https://man7.org/linux/man-pages/man3/pthread_setaffinity_np.3.html
+ *  [2] https://www.kernel.org/doc/html/latest/admin-guide/cputopology.html
+ *  [3] https://www.kernel.org/doc/html/latest/admin-guide/mm/numa_memory_policy.html (first touch)
+ */
+
+#ifndef THREADPLACEMENT_H_
+#define THREADPLACEMENT_H_
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+class ThreadPlacement {
+  public:
+	enum Policy {
+		NONE,		// threads are placed by the OS
+		COMPACT,	// fill all cores of the first NUMA node first, then the second node, ...
+		SCATTER,	// round robin over the NUMA nodes
+		LIST		// user defined list of cores
+	};
+
+	/** default constructor; threads will not be pinned
+	 *
+	 *  @param	---
+	 *  @return ---
+	*/
+	ThreadPlacement();
+
+	/** overloaded constructor; the NUMA topology is read from /sys/devices/system/node, only cores available for
+	 * 	this process are used.
+	 *
+	 *  @param	specify the policy (NONE, COMPACT or SCATTER)
+	 *  @return ---
+	*/
+	ThreadPlacement(Policy policy);
+
+	/** overloaded constructor for the policy LIST; worker i will be pinned to cores[i % cores.size()]
+	 *
+	 *  @param	specify the list of cores
+	 *  @return ---
+	*/
+	ThreadPlacement(const std::vector<int> &cores);
+
+	/** function to create a placement from its description: "none", "compact", "scatter" or a comma separated list
+	 * 	of cores (e.g. "0,2,4,6"). An unknown description results in "none".
+	 *
+	 *  @param	specify the description
+	 *  @return the placement
+	*/
+	static ThreadPlacement parse(const std::string &description);
+
+	/** function to get the core of a worker
+	 *
+	 *  @param	specify the index of the worker
+	 *  @return the core, -1 if the worker will not be pinned
+	*/
+	int getCore(int workerIndex);
+
+	/** function to get the NUMA node of a core
+	 *
+	 *  @param	specify the core
+	 *  @return the id of the node as listed in /sys/devices/system/node/online, -1 if unknown
+	*/
+	int getNode(int core);
+
+	/** function to pin the calling thread to the core of the worker; has to be called by the worker itself before it
+	 * 	touches its memory, so the pages are allocated on the node of the worker (first touch).
+	 *
+	 *  @param	specify the index of the worker
+	 *  @return true if the thread was pinned (or the policy is NONE)
+	*/
+	bool pinCurrentThread(int workerIndex);
+
+	/** function to describe the placement of a worker for the instrumentation output
+	 *
+	 *  @param	specify the index of the worker
+	 *  @return e.g. "core 3 (node 0)" or "not pinned"
+	*/
+	std::string describe(int workerIndex);
+
+	Policy getPolicy();
+
+  private:
+	void readTopology();
+
+	Policy policy;
+
+	// cores of each NUMA node and the id of the node (ids of the kernel, not necessarily 0, 1, 2, ...)
+	std::vector< std::vector<int> > nodes;
+	std::vector<int> nodeIds;
+
+	// order in which the workers are assigned to the cores
+	std::vector<int> cores;
+};
+
+#endif /* THREADPLACEMENT_H_ */
@@ -0,0 +1,205 @@
+/*
+ * TileCache.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <sstream>
+#include <thread>
+
+#include "TileCache.h"
+
+TileCache::TileCache() { }
+
+TileCache* TileCache::getInstance() {
+	// function local static -> constructed exactly once, even if the first call comes from several threads at once
+	static TileCache instance;
+	return &instance;
+}
+
+std::string TileCache::makeKey(const std::string &formula, double stepRe, double stepIm, double phaseRe, double phaseIm,
+		long long tileX, long long tileY, int iterations) {
+	char buf[256];
+
+	snprintf(buf, sizeof(buf), "%.12e %.12e %lld %lld %lld %lld %d",
+			stepRe, stepIm, std::llround(phaseRe * 4096), std::llround(phaseIm * 4096), tileX, tileY, iterations);
+
+	return formula + " " + buf;
+}
+
+bool TileCache::lookup(const std::string &key, std::vector<unsigned char> &tile) {
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+
+		if (!enabled) {
+			return false;
+		}
+
+		auto it = index.find(key);
+
+		if (it != index.end()) {
+			// move the tile to the front -> most recently used
+			tiles.splice(tiles.begin(), tiles, it->second);
+			tile = it->second->second;
+			hits++;
+			return true;
+		}
+
+		if (diskStore == "") {
+			misses++;
+			return false;
+		}
+	}
+
+	// disk access without holding the lock, other threads can still use the memory cache
+	if (loadFromDisk(key, tile)) {
+		std::lock_guard<std::mutex> lock(mtx);
+		insert(key, tile);
+		hits++;
+		return true;
+	}
+
+	std::lock_guard<std::mutex> lock(mtx);
+	misses++;
+	return false;
+}
+
+void TileCache::store(const std::string &key, const std::vector<unsigned char> &tile) {
+	std::string directory;
+
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+
+		if (!enabled) {
+			return;
+		}
+
+		insert(key, tile);
+		directory = diskStore;
+	}
+
+	if (directory != "") {
+		saveToDisk(key, tile);
+	}
+}
+
+void TileCache::insert(const std::string &key, const std::vector<unsigned char> &tile) {
+	auto it = index.find(key);
+
+	if (it != index.end()) {
+		// another thread computed the same tile in the meantime
+		tiles.splice(tiles.begin(), tiles, it->second);
+		return;
+	}
+
+	tiles.push_front(std::make_pair(key, tile));
+	index[key] = tiles.begin();
+
+	while (tiles.size() > capacity) {
+		// evict the least recently used tile
+		index.erase(tiles.back().first);
+		tiles.pop_back();
+	}
+}
+
+void TileCache::setEnabled(bool enabled) {
+	std::lock_guard<std::mutex> lock(mtx);
+	this->enabled = enabled;
+}
+
+bool TileCache::isEnabled() {
+	std::lock_guard<std::mutex> lock(mtx);
+	return enabled;
+}
+
+void TileCache::setCapacity(size_t numOfTiles) {
+	std::lock_guard<std::mutex> lock(mtx);
+	capacity = numOfTiles;
+
+	while (tiles.size() > capacity) {
+		index.erase(tiles.back().first);
+		tiles.pop_back();
+	}
+}
+
+void TileCache::setDiskStore(const std::string &directory) {
+	std::lock_guard<std::mutex> lock(mtx);
+	diskStore = directory;
+}
+
+void TileCache::clear() {
+	std::lock_guard<std::mutex> lock(mtx);
+	tiles.clear();
+	index.clear();
+	hits = 0;
+	misses = 0;
+}
+
+size_t TileCache::getHits() {
+	std::lock_guard<std::mutex> lock(mtx);
+	return hits;
+}
+
+size_t TileCache::getMisses() {
+	std::lock_guard<std::mutex> lock(mtx);
+	return misses;
+}
+
+std::string TileCache::diskFilename(const std::string &key) {
+	std::string directory;
+
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		directory = diskStore;
+	}
+
+	std::stringstream name;
+	name << directory << "/" << std::hex << std::hash<std::string>()(key) << ".tile";
+
+	return name.str();
+}
+
+bool TileCache::loadFromDisk(const std::string &key, std::vector<unsigned char> &tile) {
+	std::ifstream in(diskFilename(key), std::ios::binary);
+	std::string line = "";
+
+	if (!in.is_open() || !std::getline(in, line) || line != key) {
+		// no tile on disk or hash collision
+		return false;
+	}
+
+	std::vector<unsigned char> buf(tileSize * tileSize);
+	in.read((char *) buf.data(), buf.size());
+
+	if (in.gcount() != (std::streamsize) buf.size()) {
+		return false;
+	}
+
+	tile = buf;
+	return true;
+}
+
+void TileCache::saveToDisk(const std::string &key, const std::vector<unsigned char> &tile) {
+	std::string filename = diskFilename(key);
+
+	// write to a temporary file first and rename it afterwards, a concurrent reader never sees a half written tile
+	std::stringstream tmpFilename;
+	tmpFilename << filename << "." << std::this_thread::get_id() << ".tmp";
+
+	{
+		std::ofstream out(tmpFilename.str(), std::ios::binary);
+
+		if (!out.is_open()) {
+			std::cout << "error: Unable to write tile " << tmpFilename.str() << std::endl;
+			return;
+		}
+
+		out << key << "\n";
+		out.write((const char *) tile.data(), tile.size());
+	}
+
+	std::rename(tmpFilename.str().c_str(), filename.c_str());
+}
@@ -0,0 +1,126 @@
+/*
+ * TileCache.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ *  src:
+ *
+ *  [1]	https://en.cppreference.com/w/cpp/container/list/splice
+ *  [2] https://en.wikipedia.org/wiki/Content-addressable_storage
+ *  [3] https://en.cppreference.com/w/cpp/io/c/fprintf (%a -> exact hexadecimal floating point)
+ */
+
+#ifndef TILECACHE_H_
+#define TILECACHE_H_
+
+#include <iostream>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class TileCache {
+  public:
+	/** edge length of a cached tile in pixels; tiles are aligned to a lattice in the complex plane with the pixel scale as
+	 *  spacing: tile (tx|ty) covers the lattice columns tx*tileSize ... (tx+1)*tileSize-1, where lattice column n lies at
+	 *  c_re = (n + phaseRe) * stepRe (rows analog, counted downwards from Im = 0).
+	 */
+	static const unsigned tileSize = 32;
+
+	static TileCache* getInstance();
+
+	/** function to build the content address of a tile. The key contains everything which influences the result of a tile:
+	 *  the formula, the lattice (pixel scale and the sub pixel phase of the lattice against the origin), the tile coordinates
+	 *  on the lattice and the number of iterations. The key does not depend on the viewport, so a panned render finds the
+	 *  tiles of the previous frame. The pixel scale is written with 12 significant digits and the phase in 1/4096 pixel,
+	 *  so viewports which differ only by rounding errors of their origin share their tiles.
+	 *
+	 *  @param	specify the name of the formula (e.g. "mandelbrot")
+	 *  @param	specify the pixel scale in real and imaginary direction
+	 *  @param	specify the phase of the lattice in pixels (-0.5 ... 0.5) in real and imaginary direction
+	 *  @param	specify the tile coordinates (tileX, tileY) on the lattice and the number of iterations
+	 *  @return the key of the tile
+	*/
+	static std::string makeKey(const std::string &formula, double stepRe, double stepIm, double phaseRe, double phaseIm,
+			long long tileX, long long tileY, int iterations);
+
+	/** function to look up a tile; first the memory cache is checked, then (if set) the disk store. A tile found on disk
+	 *  will be inserted into the memory cache.
+	 *
+	 *  @param	specify the key of the tile (see makeKey())
+	 *  @return true if the tile was found, &tile will contain tileSize*tileSize values (1 = inside, 0 = outside) in rows
+	*/
+	bool lookup(const std::string &key, std::vector<unsigned char> &tile);
+
+	/** function to store a computed tile in the memory cache (the least recently used tile will be evicted if the capacity
+	 *  is reached) and, if set, in the disk store.
+	 *
+	 *  @param	specify the key of the tile (see makeKey())
+	 *  @param	pass the tile, tileSize*tileSize values (1 = inside, 0 = outside) in rows
+	 *  @return ---
+	*/
+	void store(const std::string &key, const std::vector<unsigned char> &tile);
+
+	/** function to enable / disable the cache; if disabled, lookup() will always fail and store() does nothing.
+	 *
+	 *  @param	true to enable the cache (default), false to disable it
+	 *  @return ---
+	*/
+	void setEnabled(bool enabled);
+
+	bool isEnabled();
+
+	/** function to set the maximum number of tiles held in memory (default 4096 tiles -> 4 Mb with tileSize 32)
+	 *
+	 *  @param	specify the number of tiles
+	 *  @return ---
+	*/
+	void setCapacity(size_t numOfTiles);
+
+	/** function to back the memory cache with a directory on disk; each tile is stored in a file named by the hash of its key,
+	 * 	the first line of the file contains the full key to detect hash collisions. An empty string disables the disk store.
+	 *
+	 *  @param	specify the directory of the disk store (has to exist)
+	 *  @return ---
+	*/
+	void setDiskStore(const std::string &directory);
+
+	/** function to remove all tiles from the memory cache and reset the statistics; the disk store is untouched.
+	 *
+	 *  @param	---
+	 *  @return ---
+	*/
+	void clear();
+
+	size_t getHits();
+
+	size_t getMisses();
+
+  private:
+	TileCache();
+
+	std::string diskFilename(const std::string &key);
+
+	bool loadFromDisk(const std::string &key, std::vector<unsigned char> &tile);
+
+	void saveToDisk(const std::string &key, const std::vector<unsigned char> &tile);
+
+	void insert(const std::string &key, const std::vector<unsigned char> &tile);
+
+	std::mutex mtx;
+
+	// most recently used tile at the front of the list
+	std::list< std::pair<std::string, std::vector<unsigned char> > > tiles;
+	std::unordered_map< std::string, std::list< std::pair<std::string, std::vector<unsigned char> > >::iterator > index;
+
+	bool enabled = true;
+	size_t capacity = 4096;
+	std::string diskStore = "";
+
+	size_t hits = 0;
+	size_t misses = 0;
+};
+
+#endif /* TILECACHE_H_ */
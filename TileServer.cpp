@@ -0,0 +1,396 @@
+/*
+ * TileServer.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <thread>
+#include <unistd.h>
+
+#include "Mandelbrot.h"
+#include "TileServer.h"
+
+TileServer::TileServer(int port, int numOfThreads, int iterations) {
+	this->port = port;
+	this->numOfThreads = numOfThreads;
+	this->iterations = iterations;
+}
+
+std::shared_future<std::string> TileServer::requestTile(int z, unsigned x, unsigned y, bool inView) {
+	std::string key = std::to_string(z) + "/" + std::to_string(x) + "/" + std::to_string(y);
+
+	std::lock_guard<std::mutex> lock(mtx);
+
+	auto hot = hotIndex.find(key);
+
+	if (hot != hotIndex.end()) {
+		hotTiles.splice(hotTiles.begin(), hotTiles, hot->second);
+
+		std::promise<std::string> ready;
+		ready.set_value(hot->second->second);
+		return ready.get_future().share();
+	}
+
+	if (inView) {
+		view.push_front(Job { 0, sequence, key, z, x, y });
+
+		if (view.size() > viewSize) {
+			view.pop_back();
+		}
+
+		// the client panned on -> prefetches around the old view are not needed anymore
+		if (jobs.size() > viewSize * 9) {
+			dropStalePrefetches();
+		}
+	}
+
+	auto it = pending.find(key);
+
+	if (it != pending.end()) {
+		// the tile is already requested -> wait for the same result
+		if (inView && !it->second.inView) {
+			it->second.inView = true;
+
+			if (!it->second.started) {
+				// a prefetched tile came into view -> queue it again with the higher priority
+				jobs.push(Job { 0, sequence++, key, z, x, y });
+				jobAvailable.notify_one();
+			}
+		}
+		return it->second.result;
+	}
+
+	PendingTile &tile = pending[key];
+	tile.result = tile.promise.get_future().share();
+	tile.inView = inView;
+
+	jobs.push(Job { inView ? 0 : 1, sequence++, key, z, x, y });
+	jobAvailable.notify_one();
+
+	return tile.result;
+}
+
+bool TileServer::isStale(const Job &job) {
+	if (job.priority == 0) {
+		return false;
+	}
+
+	for (const Job &tile : view) {
+		long dx = (long) job.x - (long) tile.x, dy = (long) job.y - (long) tile.y;
+
+		if (tile.z == job.z && dx >= -1 && dx <= 1 && dy >= -1 && dy <= 1) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void TileServer::dropStalePrefetches() {
+	std::vector<Job> keep;
+
+	while (!jobs.empty()) {
+		const Job &job = jobs.top();
+		auto it = pending.find(job.key);
+
+		if (!isStale(job)) {
+			keep.push_back(job);
+		} else if (it != pending.end() && !it->second.started && !it->second.inView) {
+			// nobody waits for the tile
+			pending.erase(it);
+		}
+
+		jobs.pop();
+	}
+
+	for (const Job &job : keep) {
+		jobs.push(job);
+	}
+}
+
+std::string TileServer::renderTile(int z, unsigned x, unsigned y) {
+	// zoom level z is a (256 << z) x (256 << z) image of the default viewport, the tile is a part image of it
+	unsigned size = tileSize << z;
+
+	Mandelbrot mandelbrot(size, size, x * tileSize, (x + 1) * tileSize, y * tileSize, (y + 1) * tileSize, iterations);
+	mandelbrot.setViewport(-0.65, 0, 2.4 / size);
+
+	// the tiles are kept in the hot tile cache of the server, the TileCache would only be flooded with tiles of every zoom level
+	mandelbrot.setUseTileCache(false);
+
+	std::vector<unsigned char> inside;
+	mandelbrot.calculateRegion(inside);
+
+	return encodeBMP(inside);
+}
+
+void TileServer::renderThread() {
+	while (true) {
+		Job job;
+
+		{
+			std::unique_lock<std::mutex> lock(mtx);
+			jobAvailable.wait(lock, [this]() { return !jobs.empty(); });
+
+			job = jobs.top();
+			jobs.pop();
+
+			auto it = pending.find(job.key);
+
+			// tile already rendered or in progress (queued twice after a priority change)
+			if (it == pending.end() || it->second.started) {
+				continue;
+			}
+
+			// prefetch of a region the client already left
+			if (isStale(job) && !it->second.inView) {
+				pending.erase(it);
+				continue;
+			}
+
+			it->second.started = true;
+		}
+
+		std::string tile = renderTile(job.z, job.x, job.y);
+
+		std::promise<std::string> promise;
+
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+
+			hotTiles.push_front(std::make_pair(job.key, tile));
+			hotIndex[job.key] = hotTiles.begin();
+
+			while (hotTiles.size() > hotCapacity) {
+				hotIndex.erase(hotTiles.back().first);
+				hotTiles.pop_back();
+			}
+
+			promise = std::move(pending[job.key].promise);
+			pending.erase(job.key);
+		}
+
+		promise.set_value(tile);
+	}
+}
+
+std::string TileServer::encodeBMP(const std::vector<unsigned char> &inside) {
+	// 1 bit per pixel with a palette of 2 colors: 0 = black (inside), 1 = white (outside)
+	unsigned rowSize = tileSize / 8;
+	unsigned dataOffset = 14 + 40 + 8;
+	unsigned fileSize = dataOffset + rowSize * tileSize;
+
+	std::string bmp(fileSize, '\0');
+
+	auto write32 = [&bmp](unsigned offset, unsigned value) {
+		for (int i = 0; i < 4; i++) {
+			bmp[offset + i] = (char) ((value >> (8 * i)) & 0xff);
+		}
+	};
+
+	// file header
+	bmp[0] = 'B';
+	bmp[1] = 'M';
+	write32(2, fileSize);
+	write32(10, dataOffset);
+
+	// info header
+	write32(14, 40);
+	write32(18, tileSize);
+	write32(22, tileSize);
+	bmp[26] = 1;		// planes
+	bmp[28] = 1;		// bits per pixel
+	write32(34, rowSize * tileSize);
+	write32(46, 2);		// colors in the palette
+
+	// palette (blue, green, red, reserved)
+	write32(54, 0x000000);
+	write32(58, 0xffffff);
+
+	// rows are stored bottom-up
+	for (unsigned y = 0; y < tileSize; y++) {
+		unsigned row = dataOffset + (tileSize - 1 - y) * rowSize;
+
+		for (unsigned x = 0; x < tileSize; x++) {
+			if (!inside[y * tileSize + x]) {
+				bmp[row + x / 8] |= (char) (0x80 >> (x % 8));
+			}
+		}
+	}
+
+	return bmp;
+}
+
+void TileServer::handleConnection(int connection) {
+	std::string request = "";
+	char buf[1024];
+
+	// a silent or stalled client must not block the connection thread forever
+	timeval timeout = {};
+	timeout.tv_sec = connectionTimeout;
+	setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+	setsockopt(connection, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+	// read the request header
+	while (request.find("\r\n\r\n") == std::string::npos && request.size() < 8192) {
+		ssize_t n = recv(connection, buf, sizeof(buf), 0);
+
+		if (n <= 0) {
+			break;
+		}
+
+		request.append(buf, n);
+	}
+
+	std::string path = "";
+	size_t begin = request.find(' ');
+
+	if (request.compare(0, 4, "GET ") == 0 && begin != std::string::npos) {
+		path = request.substr(begin + 1, request.find(' ', begin + 1) - begin - 1);
+	}
+
+	std::string status = "404 Not Found";
+	std::string contentType = "text/plain";
+	std::string body = "not found\n";
+
+	int z = 0;
+	unsigned x = 0, y = 0;
+	char end = '\0';
+
+	if (path == "/") {
+		status = "200 OK";
+		contentType = "text/html";
+		body = "<!DOCTYPE html><html><head><title>Mandelbrot</title>"
+			   "<link rel=\"stylesheet\" href=\"https://unpkg.com/leaflet@1.9.4/dist/leaflet.css\"/>"
+			   "<script src=\"https://unpkg.com/leaflet@1.9.4/dist/leaflet.js\"></script></head>"
+			   "<body style=\"margin:0\"><div id=\"map\" style=\"height:100vh\"></div><script>"
+			   "var map = L.map('map', { crs: L.CRS.Simple, minZoom: 0, maxZoom: " + std::to_string(maxZoom) + " });"
+			   "L.tileLayer('/{z}/{x}/{y}.bmp', { noWrap: true, bounds: [[-256, 0], [0, 256]] }).addTo(map);"
+			   "map.setView([-128, 128], 1);"
+			   "</script></body></html>";
+	} else if (sscanf(path.c_str(), "/%d/%u/%u%c", &z, &x, &y, &end) >= 3 && (end == '\0' || end == '.')
+			&& z >= 0 && z <= maxZoom && x < (1u << z) && y < (1u << z)) {
+		std::shared_future<std::string> tile = requestTile(z, x, y, true);
+
+		// prefetch the neighbours, the client will most likely need them next
+		for (int dy = -1; dy <= 1; dy++) {
+			for (int dx = -1; dx <= 1; dx++) {
+				long nx = (long) x + dx, ny = (long) y + dy;
+
+				if ((dx != 0 || dy != 0) && nx >= 0 && ny >= 0 && nx < (1l << z) && ny < (1l << z)) {
+					requestTile(z, nx, ny, false);
+				}
+			}
+		}
+
+		status = "200 OK";
+		contentType = "image/bmp";
+		body = tile.get();
+	}
+
+	std::string response = "HTTP/1.1 " + status + "\r\n"
+						 + "Content-Type: " + contentType + "\r\n"
+						 + "Content-Length: " + std::to_string(body.size()) + "\r\n"
+						 + "Cache-Control: max-age=86400\r\n"
+						 + "Connection: close\r\n\r\n" + body;
+
+	size_t sent = 0;
+
+	while (sent < response.size()) {
+		ssize_t n = send(connection, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+
+		if (n <= 0) {
+			break;
+		}
+
+		sent += n;
+	}
+
+	close(connection);
+}
+
+bool TileServer::run() {
+	int server = socket(AF_INET, SOCK_STREAM, 0);
+
+	if (server < 0) {
+		std::cout << "error: Unable to create socket." << std::endl;
+		return false;
+	}
+
+	int reuse = 1;
+	setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+	sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = htons(port);
+
+	if (bind(server, (sockaddr *) &address, sizeof(address)) < 0 || listen(server, 64) < 0) {
+		std::cout << "error: Unable to listen on port " << port << "." << std::endl;
+		close(server);
+		return false;
+	}
+
+	for (int i = 0; i < numOfThreads; i++) {
+		std::thread(&TileServer::renderThread, this).detach();
+	}
+
+	std::cout << "Serving tiles on http://127.0.0.1:" << port << "/ with " << numOfThreads << " threads ..." << std::endl;
+
+	// fixed number of connection threads, further connections wait in the listen backlog
+	std::vector<std::thread> connections;
+
+	for (int i = 0; i < maxConnections; i++) {
+		connections.push_back(std::thread(&TileServer::connectionThread, this, server));
+	}
+
+	for (auto &th : connections) {
+		th.join();
+	}
+
+	return true;
+}
+
+void TileServer::connectionThread(int server) {
+	// pause after running out of resources (e.g. EMFILE), doubled while the error persists
+	std::chrono::milliseconds backoff(0);
+
+	while (true) {
+		int connection = accept(server, nullptr, nullptr);
+
+		if (connection < 0) {
+			if (errno == EINTR || errno == ECONNABORTED) {
+				continue;
+			}
+
+			if (errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM) {
+				// the pending connection stays in the backlog until a descriptor is closed again
+				if (backoff.count() == 0) {
+					std::cout << "error: Unable to accept a connection (" << strerror(errno) << "), retrying." << std::endl;
+				}
+
+				backoff = std::min(std::max(2 * backoff, std::chrono::milliseconds(50)), std::chrono::milliseconds(2000));
+
+				std::this_thread::sleep_for(backoff);
+				continue;
+			}
+
+			// the listening socket is unusable, retrying would only spin
+			std::cout << "error: Unable to accept a connection (" << strerror(errno) << "), connection thread stopped." << std::endl;
+			return;
+		}
+
+		backoff = std::chrono::milliseconds(0);
+
+		handleConnection(connection);
+	}
+}
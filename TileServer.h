@@ -0,0 +1,143 @@
+/*
+ * TileServer.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ *  src:
+ *
+ *  [1]	https://wiki.openstreetmap.org/wiki/Slippy_map_tilenames
+ *  [2] https://en.wikipedia.org/wiki/BMP_file_format
+ *  [3] https://beej.us/guide/bgnet/html/
+ *  [4] https://leafletjs.com/examples/crs-simple/crs-simple.html
+ */
+
+#ifndef TILESERVER_H_
+#define TILESERVER_H_
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <iostream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <vector>
+
+class TileServer {
+  public:
+	/** edge length of a served tile in pixels */
+	static const unsigned tileSize = 256;
+
+	/** deepest zoom level, 256 << maxZoom pixels have to fit into the unsigned width of the Mandelbrot class */
+	static const int maxZoom = 22;
+
+	/** number of connection threads = maximum number of connections served at the same time */
+	static const int maxConnections = 32;
+
+	/** seconds a connection may stay silent while sending its request, or stall while receiving the response */
+	static const int connectionTimeout = 5;
+
+	/** number of tiles most recently requested in view, prefetches of tiles which are no neighbour of them are dropped */
+	static const size_t viewSize = 64;
+
+	/** constructor; the server will listen on 127.0.0.1:port and render the tiles with numOfThreads threads
+	 *
+	 *  @param	specify the port
+	 *  @param	specify the number of render threads and iterations
+	 *  @return ---
+	*/
+	TileServer(int port, int numOfThreads, int iterations);
+
+	/** function to start the server; serves tiles in the slippy map layout until the process is terminated:
+	 *
+	 * 		GET /				-> html page to browse the fractal
+	 * 		GET /z/x/y.bmp		-> tile x, y (0 ... 2^z - 1) of zoom level z, zoom level 0 shows the default viewport
+	 *
+	 *  @param	---
+	 *  @return false if the server could not be started
+	*/
+	bool run();
+
+	/** function to render and encode one tile with the Mandelbrot engine (independent from the running server)
+	 *
+	 *  @param	specify the tile (zoom level z, x, y)
+	 *  @return the tile as bmp file
+	*/
+	std::string renderTile(int z, unsigned x, unsigned y);
+
+  private:
+	struct Job
+	{
+		// 0 = requested by a client (in view), 1 = prefetch of a neighbour
+		int priority;
+		// newer requests first -> tiles of the current view before tiles the client scrolled away from
+		unsigned long sequence;
+		std::string key;
+		int z;
+		unsigned x, y;
+
+		bool operator<(const Job &job) const {
+			if (priority != job.priority) {
+				return priority > job.priority;
+			}
+			return sequence < job.sequence;
+		}
+	};
+
+	struct PendingTile
+	{
+		std::promise<std::string> promise;
+		std::shared_future<std::string> result;
+		bool started = false;
+		// a client waits for the tile -> never dropped
+		bool inView = false;
+	};
+
+	/** function to get a tile; the tile is taken from the hot tile cache, or joins an already pending request of the same
+	 * 	tile, or is queued for the render threads.
+	 *
+	 *  @param	specify the tile (zoom level z, x, y)
+	 *  @param	true if the tile is in view of the client, false for a prefetch
+	 *  @return future of the encoded tile
+	*/
+	std::shared_future<std::string> requestTile(int z, unsigned x, unsigned y, bool inView);
+
+	void renderThread();
+
+	/** function to check if a job is a prefetch which is no neighbour of the current view of the client (the last
+	 * 	viewSize tiles requested in view); has to be called with mtx locked
+	 *
+	 *  @param	specify the job
+	 *  @return true if the job can be dropped
+	*/
+	bool isStale(const Job &job);
+
+	// removes the stale prefetches from the queue, has to be called with mtx locked
+	void dropStalePrefetches();
+
+	void connectionThread(int server);
+
+	void handleConnection(int connection);
+
+	static std::string encodeBMP(const std::vector<unsigned char> &inside);
+
+	int port, numOfThreads, iterations;
+
+	std::mutex mtx;
+	std::condition_variable jobAvailable;
+	std::priority_queue<Job> jobs;
+	std::map<std::string, PendingTile> pending;
+	unsigned long sequence = 0;
+
+	// tiles most recently requested in view, newest at the front
+	std::deque<Job> view;
+
+	// hot tiles, most recently used at the front
+	std::list< std::pair<std::string, std::string> > hotTiles;
+	std::map< std::string, std::list< std::pair<std::string, std::string> >::iterator > hotIndex;
+	size_t hotCapacity = 1024;
+};
+
+#endif /* TILESERVER_H_ */
@@ -0,0 +1,62 @@
+/*
+ * TileStream.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <exception>
+#include <utility>
+
+#include "TileStream.h"
+
+TileStream TileStream::promise_type::get_return_object() {
+	return TileStream(std::coroutine_handle<promise_type>::from_promise(*this));
+}
+
+std::suspend_always TileStream::promise_type::yield_value(Tile &&tile) {
+	current = std::move(tile);
+	return {};
+}
+
+void TileStream::promise_type::unhandled_exception() {
+	std::cout << "error: Tile producer failed." << std::endl;
+	std::terminate();
+}
+
+TileStream::TileStream(std::coroutine_handle<promise_type> handle) {
+	this->handle = handle;
+}
+
+TileStream::TileStream(TileStream &&other) {
+	handle = std::exchange(other.handle, nullptr);
+}
+
+TileStream &TileStream::operator=(TileStream &&other) {
+	if (this != &other) {
+		if (handle) {
+			handle.destroy();
+		}
+		handle = std::exchange(other.handle, nullptr);
+	}
+	return *this;
+}
+
+TileStream::~TileStream() {
+	if (handle) {
+		handle.destroy();
+	}
+}
+
+bool TileStream::next() {
+	if (!handle || handle.done()) {
+		return false;
+	}
+
+	handle.resume();
+
+	return !handle.done();
+}
+
+Tile &TileStream::get() {
+	return handle.promise().current;
+}
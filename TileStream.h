@@ -0,0 +1,82 @@
+/*
+ * TileStream.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ *  src:
+ *
+ *  [1]	https://en.cppreference.com/w/cpp/language/coroutines
+ *  [2] https://lewissbaker.github.io/2018/09/05/understanding-the-promise-type
+ *  [3] https://en.wikipedia.org/wiki/Back_pressure#Backpressure_in_information_technology
+ */
+
+#ifndef TILESTREAM_H_
+#define TILESTREAM_H_
+
+#include <coroutine>
+#include <iostream>
+#include <vector>
+
+/** finished part image minX ... maxX, minY ... maxY of a stream */
+struct Tile
+{
+	unsigned minX, maxX, minY, maxY;
+
+	// 1 (inside) or 0 (outside) for each pixel of the tile in rows
+	std::vector<unsigned char> inside;
+};
+
+/** lazily evaluated sequence of finished tiles (C++20 coroutine generator). The producer runs only inside next(): while
+ * 	the consumer does not pull, the coroutine stays suspended and no further tiles are started. Usage:
+ *
+ * 		TileStream stream = mandelbrot.streamTiles(600, 32, 4);
+ *
+ * 		while (stream.next()) {
+ * 			write(stream.get());
+ * 		}
+ */
+class TileStream {
+  public:
+	struct promise_type
+	{
+		Tile current;
+
+		TileStream get_return_object();
+		std::suspend_always initial_suspend() { return {}; }
+		std::suspend_always final_suspend() noexcept { return {}; }
+		std::suspend_always yield_value(Tile &&tile);
+		void return_void() { }
+		void unhandled_exception();
+	};
+
+	TileStream(TileStream &&other);
+	TileStream &operator=(TileStream &&other);
+
+	TileStream(const TileStream &) = delete;
+	TileStream &operator=(const TileStream &) = delete;
+
+	/** destructor; destroys the suspended producer, tiles which are still computed are awaited
+	 */
+	virtual ~TileStream();
+
+	/** function to pull the next tile; the producer runs until it has the next tile finished
+	 *
+	 *  @param	---
+	 *  @return false if the stream is done
+	*/
+	bool next();
+
+	/** function to get the tile of the last successful next(); the tile can be moved away by the consumer
+	 *
+	 *  @param	---
+	 *  @return reference to the current tile
+	*/
+	Tile &get();
+
+  private:
+	explicit TileStream(std::coroutine_handle<promise_type> handle);
+
+	std::coroutine_handle<promise_type> handle;
+};
+
+#endif /* TILESTREAM_H_ */
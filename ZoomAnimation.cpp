@@ -0,0 +1,172 @@
+/*
+ * ZoomAnimation.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#include "ZoomAnimation.h"
+
+ZoomAnimation::ZoomAnimation(unsigned width, unsigned height, int numOfThreads, int iterations) {
+	this->width = width;
+	this->height = height;
+	this->numOfThreads = numOfThreads;
+	this->iterations = iterations;
+}
+
+void ZoomAnimation::addKeyframe(double centerRe, double centerIm, double scale, unsigned numOfFrames) {
+	Keyframe keyframe = { centerRe, centerIm, scale, numOfFrames };
+	keyframes.push_back(keyframe);
+}
+
+std::vector<Keyframe> ZoomAnimation::createFrames() {
+	std::vector<Keyframe> frames;
+
+	if (keyframes.empty()) {
+		return frames;
+	}
+
+	frames.push_back(keyframes[0]);
+
+	for (size_t k = 1; k < keyframes.size(); k++) {
+		const Keyframe &a = keyframes[k - 1];
+		const Keyframe &b = keyframes[k];
+
+		for (unsigned f = 1; f <= b.numOfFrames; f++) {
+			double t = (double) f / b.numOfFrames;
+
+			Keyframe frame;
+			frame.centerRe = a.centerRe + t * (b.centerRe - a.centerRe);
+			frame.centerIm = a.centerIm + t * (b.centerIm - a.centerIm);
+			frame.scale = a.scale * pow(b.scale / a.scale, t);
+			frame.numOfFrames = 0;
+
+			frames.push_back(frame);
+		}
+	}
+
+	return frames;
+}
+
+size_t ZoomAnimation::calculateFrame(const Keyframe &frame, PPMImage &image, const Keyframe *previous, PPMImage *previousImage) {
+	Mandelbrot mandelbrot(width, height, 0, width, 0, height, iterations);
+	mandelbrot.setViewport(frame.centerRe, frame.centerIm, frame.scale);
+
+	/*
+	 * 	the pixel grids are nested, if the previous scale is a multiple r of the new scale and the origin of the previous
+	 * 	grid lies on the new grid (offset of p columns and q rows):
+	 *
+	 * 		previous column = (p + x) / r,	if (p + x) % r == 0
+	 * 		previous row    = (q + y) / r,	if (q + y) % r == 0
+	 */
+	bool nested = false;
+	long r = 0, p = 0, q = 0;
+
+	if (previous != nullptr && previousImage != nullptr) {
+		Mandelbrot previousMandelbrot(width, height, 0, width, 0, height, iterations);
+		previousMandelbrot.setViewport(previous->centerRe, previous->centerIm, previous->scale);
+
+		double ratio = previous->scale / frame.scale;
+		double offsetRe = (mandelbrot.getRe(0) - previousMandelbrot.getRe(0)) / frame.scale;
+		double offsetIm = (previousMandelbrot.getIm(0) - mandelbrot.getIm(0)) / frame.scale;
+
+		r = lround(ratio);
+		p = lround(offsetRe);
+		q = lround(offsetIm);
+
+		// allow rounding errors of the interpolation (far below the size of a pixel)
+		nested = r >= 1 && fabs(ratio - r) < 1e-6 && fabs(offsetRe - p) < 1e-3 && fabs(offsetIm - q) < 1e-3;
+	}
+
+	std::vector<std::thread> workers;
+	std::vector<size_t> reused(numOfThreads, 0);
+
+	for (int i = 0; i < numOfThreads; i++) {
+		// rows are interleaved between the threads -> similar work for every thread
+		workers.push_back(std::thread([&, i]() {
+			for (unsigned y = i; y < height; y += numOfThreads) {
+				long previousY = nested ? (q + (long) y) / r : -1;
+				bool rowNested = nested && (q + (long) y) % r == 0 && previousY >= 0 && previousY < (long) height;
+
+				for (unsigned x = 0; x < width; ++x) {
+					long previousX = rowNested ? (p + (long) x) / r : -1;
+
+					if (rowNested && (p + (long) x) % r == 0 && previousX >= 0 && previousX < (long) width) {
+						image[y][x] = (*previousImage)[previousY][previousX];
+						reused[i]++;
+					} else if (mandelbrot.isInside(x, y)) {
+						image[y][x].r = 0;
+						image[y][x].g = 0;
+						image[y][x].b = 0;
+					} else {
+						image[y][x].r = 1;
+						image[y][x].g = 1;
+						image[y][x].b = 1;
+					}
+				}
+			}
+		}));
+	}
+
+	for (auto &th : workers) {
+		th.join();
+	}
+
+	size_t total = 0;
+	for (size_t n : reused) {
+		total += n;
+	}
+
+	return total;
+}
+
+void ZoomAnimation::render(const std::string &filenamePrefix) {
+	std::vector<Keyframe> frames = createFrames();
+
+	std::cout << "Rendering zoom animation with " << frames.size() << " frames (" << width << "x" << height << ") ...\n";
+
+	// double buffering: frame k is written from one image while frame k+1 is calculated into the other one
+	PPMImage images[2] = { PPMImage(height, width), PPMImage(height, width) };
+	std::thread writer;
+
+	auto start = std::chrono::steady_clock::now();
+	double computeTime = 0;
+
+	for (size_t k = 0; k < frames.size(); k++) {
+		PPMImage &image = images[k % 2];
+		PPMImage *previousImage = (k > 0) ? &images[(k + 1) % 2] : nullptr;
+		const Keyframe *previous = (k > 0) ? &frames[k - 1] : nullptr;
+
+		auto frameStart = std::chrono::steady_clock::now();
+
+		size_t reused = calculateFrame(frames[k], image, previous, previousImage);
+
+		std::chrono::duration<double> frameTime = std::chrono::steady_clock::now() - frameStart;
+		computeTime += frameTime.count();
+
+		std::cout << "Frame #" << k << " calculated in " << frameTime.count() << "s (center " << frames[k].centerRe << ","
+				  << frames[k].centerIm << ", scale " << frames[k].scale << "), reused "
+				  << (100.0 * reused) / (width * height) << "% of the pixels.\n";
+
+		// frame k-1 has to be written, before the writer can take frame k
+		// (frame k+1 will be calculated into the image of frame k-1)
+		if (writer.joinable()) {
+			writer.join();
+		}
+
+		writer = std::thread([&image, filenamePrefix, k]() {
+			image.save(filenamePrefix + "-" + std::to_string(k) + ".ppm");
+		});
+	}
+
+	if (writer.joinable()) {
+		writer.join();
+	}
+
+	std::chrono::duration<double> totalTime = std::chrono::steady_clock::now() - start;
+
+	std::cout << "Finished in " << totalTime.count() << "s (calculation " << computeTime << "s).\n" << std::endl;
+}
@@ -0,0 +1,81 @@
+/*
+ * ZoomAnimation.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ *  src:
+ *
+ *  [1]	https://en.wikipedia.org/wiki/Multiple_buffering#Double_buffering_in_computer_graphics
+ *  [2] https://mathr.co.uk/blog/2010-08-31_optimizing_zoom_animations.html
+ */
+
+#ifndef ZOOMANIMATION_H_
+#define ZOOMANIMATION_H_
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Mandelbrot.h"
+#include "PPMImage.h"
+
+struct Keyframe
+{
+	double centerRe, centerIm, scale;
+	unsigned numOfFrames;
+};
+
+class ZoomAnimation {
+  public:
+	/** constructor; every frame of the animation will have the size width x height and will be calculated by numOfThreads threads
+	 *
+	 *  @param	specify the width and height of the frames
+	 *  @param	specify the number of threads and iterations
+	 *  @return ---
+	*/
+	ZoomAnimation(unsigned width, unsigned height, int numOfThreads, int iterations);
+
+	/** function to append a keyframe to the path of the animation. Between two keyframes, the center is moved linear and the
+	 * 	scale is changed exponential (constant zoom speed).
+	 *
+	 * 	Consecutive frames reuse the pixels of the previous frame if their pixel grids are nested, e.g. a fixed center with the
+	 * 	scale halved on every frame (scale -> scale / 2^numOfFrames) reuses every other pixel in both directions (1/4 of the frame).
+	 *
+	 *  @param	specify the center of the keyframe (real and imaginary part)
+	 *  @param	specify the pixel scale of the keyframe (see Mandelbrot::setViewport())
+	 *  @param	specify the number of frames from the previous keyframe to this one (ignored for the first keyframe)
+	 *  @return ---
+	*/
+	void addKeyframe(double centerRe, double centerIm, double scale, unsigned numOfFrames);
+
+	/** function to render all frames of the path. While frame k+1 is calculated, frame k is written to the file
+	 * 	"filenamePrefix-k.ppm" by a second thread.
+	 *
+	 *  @param	specify the prefix of the filenames
+	 *  @return ---
+	*/
+	void render(const std::string &filenamePrefix);
+
+	/** function to calculate one frame; pixels, which lie exactly on the pixel grid of the previous frame, are copied
+	 *
+	 *  @param	specify the frame and pass the image to store it
+	 *  @param	specify the previous frame and its image (nullptr for the first frame)
+	 *  @return number of reused pixels
+	*/
+	size_t calculateFrame(const Keyframe &frame, PPMImage &image, const Keyframe *previous, PPMImage *previousImage);
+
+  private:
+	/** function to create the list of all frames by interpolating between the keyframes
+	 *
+	 *  @param	---
+	 *  @return list of all frames (numOfFrames is unused)
+	*/
+	std::vector<Keyframe> createFrames();
+
+	unsigned width, height;
+	int numOfThreads, iterations;
+
+	std::vector<Keyframe> keyframes;
+};
+
+#endif /* ZOOMANIMATION_H_ */
@@ -1,209 +1,151 @@
+#include <algorithm>
 #include <iostream>
 #include <thread>
 #include <vector>
-#include <math.h>
 #include <string.h>
 
+#include "Analytics.h"
+#include "Buddhabrot.h"
 #include "PPMImage.h"
+#include "JuliaBatch.h"
 #include "Mandelbrot.h"
+#include "PackedBitmap.h"
+#include "RegressionCheck.h"
+#include "RenderPaths.h"
+#include "ThreadPlacement.h"
+#include "TileServer.h"
+#include "ZoomAnimation.h"
+
+int main(int argc, char *argv[]) {
+	std::cout << "Mandelbrot Fractal Generator 1.0\n" << std::endl;
 
-void createMandelbrotImageThread(Mandelbrot * mandelbrot, PPMImage &image) {
-	mandelbrot->calculateImage(image);
-}
-
-void createMandelbrotImage(PPMImage &image, unsigned int width, unsigned int height, int numOfThreads, int iterations) {
-
-	/*
-	 * 	sub image coordinate computation (e.g. 600x600, 4 threads) -> chess board method
-	 *
-	 *	-- x
-	 *	|
-	 *	y
-	 *
-	 *	P0a(0|0)		P2a(300|0)
-	 *		x_______________x_______________
-	 * 		|				|				|
-	 * 		|				|				|
-	 * 		|		0		|		2		|
-	 * 		|				|				|
-	 * 		|_______________|_______________|
-	 *						x				x
-	 * 				   P0e(300|300)	   P2e(600|300)
-	 *
-	 * 					  ------
-	 *
-	 * 	P1a(0|300)	 P3a(300|300)
-	 * 		x_______________x_______________
-	 * 		|				|				|
-	 * 		|				|				|
-	 * 		|		1		|		3		|
-	 * 		|				|				|
-	 * 		|_______________|_______________|
-	 *						x				x
-	 * 				   P1e(300|600)	   P3e(600|600)
-	 *
-	 */
-
-	std::cout << "Creating image ...\n";
-
-	// is the image divisible into numOfThreads sub pictures (chess board)
-	if ( HelperFunctions::getInstance()->isPerfectSquare(numOfThreads) == true ) {
-		int devider = sqrt(numOfThreads);
-
-		std::cout << "sub images are arranged as a chess board with " << devider << "x" << devider <<" fields." << std::endl;
-
-		// depending on the width/height, is the image still divisible into even numOfThreads sub pictures?
-		if ( width % devider == 0 ) {
-			unsigned minX, minY, maxX, maxY;
-
-			std::vector<std::thread> workers;
-
-			Mandelbrot *partMandelbrot[numOfThreads];
-
-			for (int i = 0; i < numOfThreads; i++) {
-				// coordinates calculation
-				minX = (i / devider) * (width / devider);
-				maxX = ((i / devider) + 1) * (width / devider);
-				minY = (i % devider) * (height / devider);
-				maxY = ((i % devider) + 1) * (height / devider);
-
-				partMandelbrot[i] = new Mandelbrot(width, height, minX, maxX, minY, maxY, iterations);
-
-				workers.push_back(std::thread(createMandelbrotImageThread, partMandelbrot[i], std::ref(image)));
-
-				std::cout << "Thread #" << i << " created. Calculating (" << minX << "," << minY << ") to (" << maxX << "," << maxY << ").\n";
-			}
-
-			for (auto &th : workers)
-			{
-				th.join();
-			}
-
-			std::cout << "Finished.\n" << std::endl;;
+	// usage: Cpp-Mandelbrot [mode] [files ...] [--placement=none|compact|scatter|<core>,<core>,...] [--port=8080]
+	std::string mode = "";
+	std::vector<std::string> files;
+	ThreadPlacement placement;
+	int port = 8080;
+
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+
+		if (arg.rfind("--placement=", 0) == 0) {
+			placement = ThreadPlacement::parse(arg.substr(strlen("--placement=")));
+		} else if (arg.rfind("--port=", 0) == 0) {
+			port = atoi(arg.substr(strlen("--port=")).c_str());
+		} else if (mode == "") {
+			mode = arg;
 		} else {
-			std::cout << "error: Image width/height not divisible with given amount of threads! "
-				  << width << " / " << "sqrt(" << numOfThreads << ") = "
-				  << width / sqrt(numOfThreads) << "\n" << std::endl;
-
-			std::cout << "Canceled.\n";
+			files.push_back(arg);
 		}
-	} else {
-		std::cout << "error: Number of threads doesn't match! Has to be an even number of sqrt(" << numOfThreads << ") = "
-			  << sqrt(numOfThreads) <<".\n" << std::endl;
+	}
 
-		std::cout << "Canceled.\n";
+	if (mode == "render") {
+		/* chess board method, every thread allocates and writes its own rows (NUMA first touch) */
+		PPMImage image(600, 600, true);
+
+		createMandelbrotImage(image, 600, 600, 16, 34, placement);
+		image.save("pic/mandelbrot.ppm");
+
+		return 0;
 	}
-}
 
-void createMandelbrotImageCompressedThread(Mandelbrot * mandelbrot, std::string &returnBuf) {
-	mandelbrot->calculateCompressedImage(returnBuf);
-}
+	if (mode == "analyze") {
+		/* statistics of the whole set (-2.25 ... 0.75, -1.5 ... 1.5) without any image */
+		Analytics analytics(1000, 1000, 4, 500);
+		analytics.setViewport(-0.75, 0, 3.0 / 1000);
+
+		std::cout << "Grid 1000x1000:" << std::endl;
+		analytics.print(analytics.scanGrid());
+
+		std::cout << "Stratified sampling 1000x1000 strata, 4 samples each:" << std::endl;
+		analytics.print(analytics.sampleStratified(4, 2019));
+
+		return 0;
+	}
+
+	if (mode == "buddhabrot") {
+		/* orbit density of the escaping points (Buddhabrot) and three densities as rgb channels (Nebulabrot) */
+		Buddhabrot buddhabrot(600, 600, 4);
+
+		PPMImage image(600, 600);
+		buddhabrot.render(image, 1000, 2000000, 2019);
+		image.save("pic/buddhabrot.ppm");
+
+		buddhabrot.renderNebulabrot(image, 5000, 500, 50, 2000000, 2019);
+		image.save("pic/nebulabrot.ppm");
+
+		return 0;
+	}
+
+	if (mode == "verify") {
+		/* render the configurations of the golden images and compare output and throughput */
+		RegressionCheck check("pic", "pic/golden-budgets.txt", placement);
 
-void createMandelbrotImageCompressed(std::string filename, unsigned int width, unsigned int height, int numOfThreads, int numOfCombinedBits) {
-
-	/*
-	 * 	sub image coordinate computation (e.g. 600x600, 5 threads) -> row method
-	 *
-	 *	-- x
-	 *	|
-	 *	y
-	 *
-	 *	P0a(0|0)
-	 *		x________________________________
-	 * 		|								|
-	 * 		|				0				|
-	 * 		|_______________________________|
-	 *										x
-	 *	P1a(0|150)						P0a(600|150)
-	 *		x________________________________
-	 * 		|								|
-	 * 		|				1				|
-	 * 		|_______________________________|
-	 *										x
-	 *	P2a(0|300)						P1e(600|300)
-	 *		x________________________________
-	 * 		|								|
-	 * 		|				2				|
-	 * 		|_______________________________|
-	 * 										x
-	 * 						.			P2e(600|450)
-	 * 						.
-	 * 						.
-	 *		_________________________________
-	 * 		|								|
-	 * 		|				3				|
-	 * 		|_______________________________|
-	 *		_________________________________
-	 * 		|								|
-	 * 		|				4				|
-	 * 		|_______________________________|
-	 *
-	 */
-
-	std::cout << "Creating compressed image...\n";
-
-	// buffer for the results of the threads
-	std::string * buf = new std::string[numOfThreads];
-
-	// is the image divisible into numOfThreads sub pictures (rows)
-	if ( width % numOfThreads == 0 ) {
-		int devider = numOfThreads;
-		unsigned minX, minY, maxX, maxY;
-
-		std::cout << "sub images are arranged as " << devider << "x" << " rows." << std::endl;
-
-		// combine maximal compressionLevel bits of the bitstream to a new number
-		// e.g. 0110 0010 ... -> 10 2 ...
-		int numCombinedBits = HelperFunctions::getInstance()->gd(width, numOfCombinedBits);
-
-		std::cout << "compression level (bits combined): " << numCombinedBits << std::endl;
-
-		std::vector<std::thread> workers;
-
-		Mandelbrot *partMandelbrot[numOfThreads];
-
-		for (int i = 0; i < numOfThreads; i++) {
-			minX = 0;
-			maxX = width;
-			minY = i * (height / numOfThreads);
-			maxY = (i+1) * (height / numOfThreads);
-
-			partMandelbrot[i] = new Mandelbrot(width, height, minX, maxX, minY, maxY);
-			partMandelbrot[i]->setCompressionLevel(numCombinedBits);
-
-			workers.push_back(std::thread(createMandelbrotImageCompressedThread, partMandelbrot[i], std::ref(buf[i])));
-
-			std::cout << "Thread #" << i << " created. Calculating (" << minX << "," << minY << ") to (" << maxX << "," << maxY << ").\n";
+		return check.run() ? 0 : 1;
+	}
+
+	if (mode == "compare") {
+		/* compare two compressed *.ppm files (any compression level) without decoding them */
+		if (files.size() != 2) {
+			std::cout << "error: compare needs two compressed *.ppm files." << std::endl;
+			return 1;
 		}
 
-		for (auto &th : workers) {
-			th.join();
+		PackedBitmap a(0, 0), b(0, 0);
+
+		if (!a.load(files[0]) || !b.load(files[1])) {
+			return 1;
 		}
 
-		std::cout << "Compressed from " << width*height << " to " << ((width * height) / numCombinedBits) << " characters -> done.\n" << std::endl;
+		std::cout << files[0] << ": " << a.getWidth() << "x" << a.getHeight() << ", " << a.popcount() << " bits set" << std::endl;
+		std::cout << files[1] << ": " << b.getWidth() << "x" << b.getHeight() << ", " << b.popcount() << " bits set" << std::endl;
 
-		// collect results and create PPM file to store the compressed image
+		if (a.getWidth() != b.getWidth() || a.getHeight() != b.getHeight()) {
+			std::cout << "error: The images have different sizes and can not be compared.\n" << std::endl;
+			return 1;
+		}
 
-		Mandelbrot mandelbrot(width, height);
+		uint64_t differences = a.countDifferences(b);
+		std::cout << "different pixels: " << differences << "\n" << std::endl;
 
-		mandelbrot.createPPMFile(filename);
+		return (differences == 0) ? 0 : 2;
+	}
 
-		for(int i=0; i < numOfThreads; i++) {
-			mandelbrot.writeToPPMFile(filename, buf[i]);
-		}
+	if (mode == "stream") {
+		/* compressed image (30 bits), written strip by strip while the next strips are computed */
+		createMandelbrotImageStreamed("pic/mandelbrot-stream.ppm", 600, 600, 4, 30);
+
+		return 0;
+	}
+
+	if (mode == "julia") {
+		/* atlas of 32x32 Julia sets, c sampled from the default viewport of the Mandelbrot set */
+		JuliaBatch batch(64, std::max(1u, std::thread::hardware_concurrency()), 100);
 
-		std::cout << "Finished.\n" << std::endl;;
-	} else {
-		std::cout << "error: Number of threads doesn't match! Has to be an even number of " << height << " / "
-			  << numOfThreads << " = "
-			  << (float)height / numOfThreads <<".\n" << std::endl;
+		batch.addParameterGrid(32, 32);
+		batch.renderAtlas(32, "pic/julia-atlas.ppm");
 
-		std::cout << "Canceled.\n";
+		return 0;
 	}
-}
 
-int main() {
-	std::cout << "Mandelbrot Fractal Generator 1.0\n" << std::endl;
+	if (mode == "serve") {
+		/* browse the fractal with a slippy map on http://127.0.0.1:8080/ */
+		TileServer server(port, std::max(1u, std::thread::hardware_concurrency()), 200);
+
+		return server.run() ? 0 : 1;
+	}
+
+	if (mode == "animate") {
+		/* zoom into the seahorse valley, the scale is halved on every frame -> every frame reuses 1/4 of the previous one */
+		ZoomAnimation animation(600, 600, 4, 200);
+
+		animation.addKeyframe(-0.743643887037151, 0.131825904205330, 2.4 / 600, 0);
+		animation.addKeyframe(-0.743643887037151, 0.131825904205330, 2.4 / 600 / 1024, 10);
+
+		animation.render("pic/mandelbrot-zoom");
+
+		return 0;
+	}
 
 //	/* example to create the Mandelbrot set depending on the number of iterations */
 //	PPMImage image_1(1024, 1024);
@@ -230,7 +172,7 @@ int main() {
 	/* test the compression level regarding to the result file size */
 	for(int i = 2; i<32; i++) {
 		if( 600 % i == 0 ) {
-			createMandelbrotImageCompressed("pic/coded/combined-bits/mandelbrot-coded-" + std::to_string(i) + ".ppm", 600, 600, 4, i);
+			createMandelbrotImageCompressed("pic/coded/combined-bits/mandelbrot-coded-" + std::to_string(i) + ".ppm", 600, 600, 4, i, placement);
 		}
 	}
 //